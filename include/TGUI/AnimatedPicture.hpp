@@ -285,6 +285,19 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // This function is called when the widget is added to a container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void initialize(Container *const container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks to be updated when the current frame has been displayed long enough.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleNextFrame();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // Draws the widget on the render target.
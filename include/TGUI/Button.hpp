@@ -298,6 +298,12 @@ namespace tgui
         Texture m_TextureDown_R;
         Texture m_TextureFocused_R;
 
+        // The L, M and R images of every state are combined in a single sprite when the image is split
+        NineSliceSprite m_SpriteNormal;
+        NineSliceSprite m_SpriteHover;
+        NineSliceSprite m_SpriteDown;
+        NineSliceSprite m_SpriteFocused;
+
         // If this is true then the L, M and R images will be used.
         // If it is false then the button is just one big image that will be stored in the M image.
         bool m_SplitImage;
@@ -145,6 +145,34 @@ namespace tgui
         virtual sf::Vector2f getSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the size of the child window, including the title bar and the borders.
+        ///
+        /// \return Full size of the child window
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getFullSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the part of the child window that is completely opaque.
+        ///
+        /// \return The area below the title bar when the background color is opaque, an empty rectangle otherwise
+        ///
+        /// The borders are included when their color is opaque as well. The title bar and the background texture are never
+        /// considered opaque, as their images may contain transparent pixels.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getOpaqueArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the distance between the position of the child window and the position of the widgets inside it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getWidgetsOffset() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the background texture of the child window.
         ///
@@ -211,16 +239,6 @@ namespace tgui
         const sf::Color& getBackgroundColor() const;
 
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// \brief Changes the transparency of the window.
-        ///
-        /// \param transparency  The transparency of the window.
-        ///                      0 is completely transparent, while 255 means fully opaque.
-        ///
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void setTransparency(unsigned char transparency);
-
-
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the title that is displayed in the title bar of the child window.
         ///
@@ -502,6 +520,10 @@ namespace tgui
         Texture   m_TextureTitleBar_M;
         Texture   m_TextureTitleBar_R;
 
+        // The L, M and R images of the title bar combined in a single sprite when the image is split.
+        // The sprite is resized while drawing as the borders are included in the width of the title bar.
+        mutable NineSliceSprite m_SpriteTitleBar;
+
         Button*  m_CloseButton;
 
         bool m_KeepInParent;
@@ -271,6 +271,15 @@ namespace tgui
         const sf::Font* getTextFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the character size of the items in the list.
+        ///
+        /// \return The text size, which depends on the item height.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the size of the borders.
         ///
@@ -31,6 +31,7 @@
 
 #include <TGUI/Widget.hpp>
 #include <TGUI/EventManager.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -100,7 +101,8 @@ namespace tgui
         ///
         /// This font will be used by all widgets that are created after calling this function.
         ///
-        /// \param font  Font to copy
+        /// \param font  Font to copy. When the font is the global font of another container (e.g. gui.getGlobalFont())
+        ///              then it is shared instead, together with the glyphs that were already rendered with it.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setGlobalFont(const sf::Font& font);
@@ -120,19 +122,19 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns a list of all the widgets.
         ///
-        /// \return Vector of all widget pointers
+        /// \return Vector of all widget pointers, ordered from the widget at the back to the one in front
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector< Widget::Ptr >& getWidgets();
+        const std::vector< Widget::Ptr >& getWidgets() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns a list of the names of all the widgets.
         ///
-        /// \return Vector of all widget names
+        /// \return Vector of all widget names, in the same order as the widgets returned by getWidgets
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector<sf::String>& getWidgetNames();
+        const std::vector<sf::String>& getWidgetNames() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,6 +192,17 @@ namespace tgui
         Widget::Ptr copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds multiple widgets to the container at once.
+        ///
+        /// \param widgets      The widgets to add, they are placed on top of each other in the given order
+        /// \param widgetNames  The names of the widgets. When this list is shorter than the list of widgets then the
+        ///                     remaining widgets are added without a name.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addRange(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = std::vector<sf::String>());
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes a single widget that was added to the container.
         ///
@@ -230,6 +243,46 @@ namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all widgets for which the predicate returns true.
+        ///
+        /// \param predicate  Function that is called once for every widget, from back to front
+        ///
+        /// \return The amount of widgets that were removed
+        ///
+        /// All widgets are removed in a single pass, so this is a lot faster than removing them one by one.
+        ///
+        /// Usage example:
+        /// \code
+        /// container.removeIf([](const tgui::Widget::Ptr& widget) { return !widget->isVisible(); });
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int removeIf(const std::function<bool(const Widget::Ptr&)>& predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes multiple widgets at once.
+        ///
+        /// \param widgets  The widgets to remove. Widgets that are not part of this container are ignored.
+        ///
+        /// All widgets are removed in a single pass, so this is a lot faster than removing them one by one.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeRange(const std::vector<Widget::Ptr>& widgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Reserves memory for the given amount of widgets.
+        ///
+        /// \param widgetCount  The amount of widgets that you are planning to have in this container
+        ///
+        /// Call this before adding a lot of widgets so that the internal storage doesn't have to grow multiple times.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserve(unsigned int widgetCount);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Focuses an widget.
         ///
@@ -271,10 +324,24 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Uncheck all the radio buttons.
         ///
+        /// Only the radio buttons that use the group of this container are unchecked.
+        /// Radio buttons that were given their own group are not affected.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void uncheckRadioButtons();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the group that is used by the radio buttons in this container.
+        ///
+        /// \return The group of this container
+        ///
+        /// Radio buttons that were given their own group with RadioButton::setGroup don't use this group.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButtonGroup::Ptr getRadioButtonGroup() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Places an widget before all other widgets.
         ///
@@ -299,6 +366,9 @@ namespace tgui
         /// \param transparency  The transparency of the widget.
         ///                      0 is completely transparent, while 255 (default) means fully opaque.
         ///
+        /// The widgets inside the container keep their own transparency, the transparency of the container is multiplied with
+        /// it while drawing. Changing the transparency thus doesn't require the widgets to be changed.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void setTransparency(unsigned char transparency);
 
@@ -357,6 +427,46 @@ namespace tgui
         bool loadWidgetsFromFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the contents of the container are kept in a texture.
+        ///
+        /// \param enabled  Should the container and its widgets be drawn on a texture?
+        ///
+        /// When caching is enabled, the container is drawn on a texture which is then drawn on the screen as a single quad.
+        /// The texture is only redrawn when the container or one of its widgets has changed, which makes drawing a large
+        /// container that rarely changes a lot cheaper. Caching is disabled by default.
+        ///
+        /// Only panels, child windows and grids make use of the cache. As the texture has the size of the container in
+        /// pixels, the contents will look blurry when the view is zoomed in.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableCaching(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the contents of the container are kept in a texture.
+        ///
+        /// \return Is caching enabled?
+        ///
+        /// \see enableCaching
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCachingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many widgets were skipped the last time the container was drawn.
+        ///
+        /// \return Amount of widgets that were not drawn because they were outside the clipping area or hidden
+        ///
+        /// Widgets that lie outside the visible part of their parent (e.g. in a panel that is too small) or outside the
+        /// window aren't drawn. Neither are widgets that are completely hidden behind the opaque area of a widget in front
+        /// of them (see Widget::getOpaqueArea). The widgets inside a skipped container are not included in the count.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCulledWidgetCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // This function is used internally by child widget to alert there parent about a callback.
@@ -365,6 +475,64 @@ namespace tgui
         virtual void addChildCallback(const Callback& callback);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Child widgets call this function when they are shown, hidden, enabled or disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childStateChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Child widgets call this function when they are marked dirty, as their position or size may have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Resets the dirty flag of this container and of all child widgets, after everything has been drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearDirtyFlags();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Adds the areas that have to be redrawn because a child widget changed to the list. The offset is the position of
+        // the widgets of this container in the coordinates of the gui. The drawn bounds of the changed widgets are updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collectDamagedAreas(std::vector<sf::FloatRect>& areas, const sf::Vector2f& offset) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the distance between the position of the container and the position of the widgets inside it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getWidgetsOffset() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Child widgets call these functions to get their update function called after the given time, or to cancel it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleChildUpdate(const Widget* widget, const sf::Time& delay);
+        void cancelChildUpdate(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the total time that was passed to the updateTime function of the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getAnimationTime() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Moves the timers of all widgets inside this container (and inside its child containers) by the given offset.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebaseTimers(const sf::Time& offset);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,6 +596,27 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Schedules the update of the child widget and makes sure that the parent will update this container in time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleChildUpdateAt(const Widget* widget, const sf::Time& currentTime, const sf::Time& wakeUpTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Removes all widgets that are marked. The marked vector is indexed in the same way as the entries of the event manager.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual unsigned int removeMarkedWidgets(const std::vector<bool>& marked);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Makes a radio button that is being removed leave the group of this container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leaveRadioButtonGroup(Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // Focuses the next widget in the container. If the last widget was focused then all widgets will be unfocused and
@@ -443,12 +632,62 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // When caching is enabled, this function draws the container on the cache texture when something changed and then
+        // draws that texture on the target with the transparency of the container. The size is the size of everything that
+        // is drawn by the draw function. The texture is also used for transparent containers when shaders aren't supported.
+        // When false is returned then the draw function has to draw everything itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawCache(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vector2f& size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Changes the render states so that everything drawn with them gets the transparency of the container.
+        // The returned value has to be passed to restoreOpacity once the container has been drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float applyOpacity(const sf::RenderTarget& target, sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Restores the transparency of the parent after the container has been drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void restoreOpacity(float opacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Replaces the global font by a font that was already registered as being used by this container.
+        // The widgets keep pointing to the old font, so it is kept alive as long as the container has widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeGlobalFont(FontData* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns whether one of the widgets was added while the font was the global font of this container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFontUsedByWidgets(const FontData* font) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Releases the old global fonts that are no longer used by any of the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseOldGlobalFonts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        std::vector<sf::String>  m_ObjName;
+        // The font is shared with the other containers that use the same font, nullptr when no font was set
+        FontData* m_GlobalFont;
 
-        sf::Font m_GlobalFont;
+        // Fonts that were replaced while there were widgets using them, they are released when the last of those widgets
+        // is removed from the container
+        std::vector<FontData*> m_OldGlobalFonts;
 
         // The internal event manager
         EventManager m_EventManager;
@@ -459,6 +698,24 @@ namespace tgui
         // A list that stores all functions that receive callbacks triggered by child widgets
         std::list< std::function<void(const Callback&)> > m_GlobalCallbackFunctions;
 
+        // The group of the radio buttons that don't have their own group
+        RadioButtonGroup::Ptr m_RadioButtonGroup;
+
+        // The texture on which the container is drawn when caching is enabled.
+        // The cache is no longer valid when the container changed while it wasn't drawn.
+        bool                       m_CachingEnabled;
+        mutable sf::RenderTexture* m_CacheTexture;
+        mutable bool               m_CacheValid;
+        mutable bool               m_CacheRedrawn;
+
+        // The amount of widgets that were outside the clipping area or hidden behind opaque widgets during the last draw,
+        // including those of child containers
+        mutable unsigned int m_CulledWidgetCount;
+
+        // Used while drawing to find the widgets that are hidden behind opaque widgets, indexed like the event manager entries
+        mutable std::vector<sf::FloatRect> m_OpaqueAreas;
+        mutable std::vector<bool>          m_OccludedWidgets;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -533,7 +790,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        sf::RenderWindow* m_Window;
+        sf::RenderTarget* m_Target;
 
 
         friend class Gui;
@@ -37,6 +37,9 @@
 #include <TGUI/Borders.hpp>
 
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/FontManager.hpp>
+#include <TGUI/TextMeasurementCache.hpp>
+#include <TGUI/NineSliceSprite.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +67,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // The time between showing and hiding the selection point of an edit box or text box (in milliseconds)
+    const sf::Int32 SelectionPointBlinkInterval = 500;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     enum WidgetPhase
     {
         WidgetPhase_Hover     = 1,
@@ -113,6 +121,12 @@ namespace tgui
     /// The texture manager will not just load the textures, but will also make sure that the textures are only loaded once.
     extern TGUI_API TextureManager TGUI_TextureManager;
 
+    /// The font manager makes sure that containers which use the same font share it, together with its glyph cache.
+    extern TGUI_API FontManager TGUI_FontManager;
+
+    /// The sizes of texts are remembered, so that widgets with the same texts don't have to measure them again.
+    extern TGUI_API TextMeasurementCache TGUI_TextMeasurementCache;
+
     /// When disabling the tab key usage, pressing tab will no longer focus another widget, but in the future this will allow to use tabs in TextBox.
     extern TGUI_API bool tabKeyUsageEnabled;
 
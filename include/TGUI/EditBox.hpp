@@ -440,6 +440,7 @@ namespace tgui
         virtual void mouseMoved(float x, float y);
         virtual void keyPressed(sf::Keyboard::Key Key);
         virtual void textEntered(sf::Uint32 Key);
+        virtual void widgetFocused();
         virtual void widgetUnfocused();
 
 
@@ -574,6 +575,11 @@ namespace tgui
         Texture  m_TextureFocused_M;
         Texture  m_TextureFocused_R;
 
+        // The L, M and R images of every state are combined in a single sprite when the image is split
+        NineSliceSprite m_SpriteNormal;
+        NineSliceSprite m_SpriteHover;
+        NineSliceSprite m_SpriteFocused;
+
         // Is there a possibility that the user is going to double click?
         bool m_PossibleDoubleClick;
 
@@ -27,6 +27,8 @@
 #define TGUI_EVENT_MANAGER_HPP
 
 
+#include <map>
+
 #include <TGUI/Widget.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,11 +75,43 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Places an widget before all other widgets.
+        // Advances the time and updates the widgets of which the timer expired.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls the update function of all widgets that asked to be updated before the given time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void processTimers(const sf::Time& currentTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves all timers by the given offset. Used when a container starts using the time of another gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebaseTimers(const sf::Time& offset);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the update function of the widget is called at the given time. An earlier timer of the widget is
+        // replaced. Returns true when no other widget has to be updated before this one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool scheduleUpdate(const Widget* widget, const sf::Time& currentTime, const sf::Time& wakeUpTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the timer of the widget, if it had one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelScheduledUpdate(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time at which the first timer expires. The function returns false when there are no timers.
+        // Timers that were replaced or cancelled are removed from the front of the heap first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getNextWakeUpTime(sf::Time& wakeUpTime) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When the tab key is pressed then this function is called. The focus will move to the next widget (if there is one).
         // This function will only work when tabKeyUsageEnabled is true.
@@ -113,21 +147,215 @@ namespace tgui
         bool focusNextWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget on top of all other widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidget(const Widget::Ptr& widget, const sf::String& widgetName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget. The function returns false when the widget wasn't found.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeWidget(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all widgets of which the entry is marked, in a single pass over the entries.
+        // The marked vector has to contain a value for every entry. Returns the amount of removed widgets.
+        // The remaining entries are stored again from back to front.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int removeMarkedWidgets(const std::vector<bool>& marked);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the given amount of widgets can be added without reallocating.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserve(unsigned int widgetCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the widget on top of or behind all other widgets. This does not depend on the amount of widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveWidgetToFront(const Widget* widget);
+        void moveWidgetToBack(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the widgets and their names, ordered from the back to the front.
+        // These lists are only rebuilt when they are requested after the widgets have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Widget::Ptr>& getWidgets() const;
+        const std::vector<sf::String>& getWidgetNames() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the widget with the given name, or nullptr when there is no such widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getWidget(const sf::String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the visible and enabled state of the widget into its entry. This has to be called every time they change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetState(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells that the position or size of the widget may have changed. This is called every time the widget is marked dirty.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateBounds(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the position and size of the visible widgets in their entries, when they were invalidated since the last call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCachedBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        // This vector will hold all widgets
-        std::vector< Widget::Ptr > m_Widgets;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the entry that holds the widget, or NoEntry when the widget is a nullptr or isn't stored here.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findEntry(const Widget* widget) const;
 
-        // The id of the focused widget
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes the entry out of the drawing order or puts it back on top or at the bottom.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unlinkEntry(unsigned int index);
+        void linkEntryOnTop(unsigned int index);
+        void linkEntryAtBottom(unsigned int index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the entry a new timer id and adds its timer to the heap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushTimer(unsigned int index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns false when the timer with the given id was replaced or cancelled, or when its entry no longer exists.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimerActive(unsigned int index, unsigned int timerId) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Every name is stored once per event manager and the entries only store its id. getNameId counts the caller as a user
+        // of the name and releaseNameId removes the name again when its last user is gone.
+        // The empty name always has id 0. findNameId returns NoEntry when no widget has the name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getNameId(const sf::String& name);
+        void releaseNameId(unsigned int nameId);
+        unsigned int findNameId(const sf::String& name) const;
+        sf::String getName(unsigned int nameId) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // The index that is used when there is no entry (e.g. below the widget at the back)
+        static const unsigned int NoEntry = 0xFFFFFFFF;
+
+        // The widgets are stored in an unordered array. Removing a widget moves the last entry in its place.
+        // The drawing order is kept as a doubly linked list through the entries, so that changing it never moves an entry.
+        // The entries also keep a copy of the widget state that is checked in every loop, so that hidden or disabled
+        // widgets can be skipped without touching the widget itself.
+        struct Entry
+        {
+            Entry(const Widget::Ptr& widgetPtr, unsigned int widgetNameId) :
+                widget (widgetPtr),
+                nameId (widgetNameId),
+                below  (NoEntry),
+                above  (NoEntry),
+                visible(widgetPtr->m_Visible),
+                enabled(widgetPtr->m_Enabled),
+                boundsChanged(true),
+                font   (nullptr),
+                timerId(0)
+            {
+            }
+
+            Widget::Ptr          widget;
+            unsigned int         nameId;
+            unsigned int         below;
+            unsigned int         above;
+            bool                 visible;
+            bool                 enabled;
+
+            // The position and size of the widget, they are only read from the widget again after it was marked dirty.
+            // The drawn bounds are the ones that the widget had when the damaged areas were last collected.
+            mutable sf::FloatRect bounds;
+            mutable sf::FloatRect drawnBounds;
+            mutable bool          boundsChanged;
+
+            // The global font of the container at the time the widget was added, the widget may still be using it
+            FontData*            font;
+
+            // When the widget has a timer then it is updated at wakeUpTime. The time passed since scheduleTime is added
+            // to the elapsed time of the widget. A timer id of 0 means that the widget has no timer.
+            unsigned int         timerId;
+            sf::Time             scheduleTime;
+            sf::Time             wakeUpTime;
+        };
+
+        // The timers are kept in a heap with the first timer to expire in front. Replaced timers are not removed from
+        // the heap, they are skipped when their id no longer matches the one of the entry.
+        struct Timer
+        {
+            // Reversed comparison, so that the standard heap functions keep the smallest time in front
+            bool operator<(const Timer& right) const
+            {
+                return wakeUpTime > right.wakeUpTime;
+            }
+
+            sf::Time     wakeUpTime;
+            unsigned int entry;
+            unsigned int id;
+        };
+
+        std::vector<Entry> m_Entries;
+
+        // The widget at the back (drawn first) and the one at the front (drawn last)
+        unsigned int m_Bottom;
+        unsigned int m_Top;
+
+        // The index of the focused entry plus one, 0 when no widget is focused
         unsigned int m_FocusedWidget;
 
+        // The ordered lists that are returned by getWidgets and getWidgetNames
+        mutable std::vector<Widget::Ptr> m_OrderedWidgets;
+        mutable std::vector<sf::String>  m_OrderedNames;
+        mutable bool                     m_OrderedListsNeedUpdate;
+
+        // The heap is mutable because outdated timers are also removed when looking for the next wake up time
+        mutable std::vector<Timer> m_Timers;
+        unsigned int               m_LastTimerId;
+
+        // The names of the widgets with the amount of entries that use them. Ids of released names are reused.
+        std::vector<sf::String>            m_Names;
+        std::vector<unsigned int>          m_NameUsers;
+        std::vector<unsigned int>          m_FreeNameIds;
+        std::map<sf::String, unsigned int> m_NameIds;
+
+        // The time that was passed to updateTime, only used by the event manager of the gui.
+        // A container without a parent schedules the timers of its widgets relative to this time.
+        sf::Time m_Time;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         // The event handler can only be used by container widgets and by the window
         friend class Grid;
         friend class Container;
         friend class Panel;
+        friend class Gui;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FONT_MANAGER_HPP
+#define TGUI_FONT_MANAGER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <list>
+#include <set>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct FontData
+    {
+        sf::Font        font;
+        std::string     filename; // Empty when the font was copied from a font that was loaded by the user
+        const sf::Font* source;   // The font of the user that was copied, or nullptr when the font was loaded from a file
+        unsigned int    users;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // A single glyph in the glyph cache of a font
+    struct TGUI_API GlyphUsage
+    {
+        bool operator<(const GlyphUsage& right) const;
+
+        const sf::Font* font;
+        unsigned int    characterSize;
+        bool            bold;
+        sf::Uint32      character;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    class TGUI_API FontManager : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FontManager();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Loads a font.
+        ///
+        /// \param filename  Filename of the font to load.
+        ///
+        /// \return The shared font, or nullptr when the font couldn't be loaded
+        ///
+        /// The second time you call this function with the same filename, the previously loaded font will be reused.
+        /// Every font has its own glyph cache, so all containers that use the same font share the same glyph textures.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FontData* getFont(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a shared font for the given font.
+        ///
+        /// \param font  A font that was returned by this manager, or a font that was loaded by the user.
+        ///
+        /// \return The shared font
+        ///
+        /// When the font belongs to the manager then it is reused. A font from the user is copied, because the manager can't
+        /// know how long the original font will stay alive. Passing the same font again reuses the copy that still exists,
+        /// so the font should not be changed while the gui is using it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FontData* copyFont(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the manager that the font is used at one more place.
+        ///
+        /// \param font  The shared font, which may be a null pointer.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addUser(FontData* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes the font.
+        ///
+        /// \param fontToRemove  The shared font, which may be a null pointer.
+        ///
+        /// When the font is no longer used anywhere then it will be removed from memory.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFont(FontData* fontToRemove);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns all fonts that are currently loaded.
+        ///
+        /// \return List of the loaded fonts, with the amount of places where they are used
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::list<FontData>& getFontData() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Renders glyphs into the glyph cache of the font before they are needed.
+        ///
+        /// \param font            The font of which the glyph cache should be filled.
+        /// \param characters      The characters that should be rendered.
+        /// \param characterSizes  The character sizes at which the characters should be rendered.
+        /// \param bold            Should the bold version of the glyphs be rendered?
+        ///
+        /// SFML only renders a glyph the first time that it is drawn, which can make the first frame with a new text size
+        /// take much longer than the others. This function can be called while showing a loading screen instead.
+        /// Calling it once per character size allows to spread the work over multiple frames.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarm(const sf::Font& font, const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Renders the glyphs from a list that was saved with saveGlyphList.
+        ///
+        /// \param filename  Filename of the glyph list.
+        ///
+        /// \return True when the file could be read
+        ///
+        /// Only the fonts that are currently loaded by the font manager are prewarmed, the glyphs of other fonts are skipped.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool prewarmFromFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Starts or stops keeping track of the glyphs that have to be rendered while drawing.
+        ///
+        /// \param enabled  Should the glyphs be tracked?
+        ///
+        /// While enabled, every text of which a widget changes the string, size or font, and every text that is measured,
+        /// is checked for glyphs that weren't rendered or prewarmed before.
+        /// This has a cost, so it is meant to be enabled during development to find out which glyphs should be prewarmed.
+        /// Glyphs that were rendered before the tracking was enabled will be reported the next time that they are needed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableGlyphTracking(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the glyphs that had to be rendered on demand, in the order in which they were first needed.
+        ///
+        /// \return Glyphs that were not prewarmed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<GlyphUsage>& getOnDemandGlyphs() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Saves the glyphs that had to be rendered on demand, so that they can be prewarmed next time.
+        ///
+        /// \param filename  Filename of the glyph list.
+        ///
+        /// \return True when the file could be written
+        ///
+        /// Glyphs are stored together with the filename of their font, so the glyphs of fonts that were not loaded from
+        /// a file by the font manager (e.g. a font that the user loaded and passed to setTextFont) are not saved.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveGlyphList(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Remembers the glyphs of a text of which the string, size or font was changed or which was measured.
+        // Nothing happens when glyph tracking is disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void trackText(const sf::Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Remembers the glyphs of a string that is rendered without sf::Text. Nothing happens when glyph tracking is disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void trackString(const sf::Font* font, unsigned int characterSize, bool bold, const sf::String& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns whether the widgets have rendered glyphs of the font at the given character size.
+        // The glyph texture of the font only exists for these sizes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCharacterSizeUsed(const sf::Font* font, unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        std::list<FontData> m_Data;
+
+        bool                    m_GlyphTracking;
+        std::set<GlyphUsage>    m_KnownGlyphs;
+        std::vector<GlyphUsage> m_OnDemandGlyphs;
+
+        // The character sizes at which glyphs were rendered, this is kept even when glyph tracking is disabled
+        std::set<std::pair<const sf::Font*, unsigned int>> m_UsedCharacterSizes;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_MANAGER_HPP
@@ -247,6 +247,12 @@ namespace tgui
         void updatePositionsOfAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the marked widgets from the grid before removing them from the container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual unsigned int removeMarkedWidgets(const std::vector<bool>& marked);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,9 @@
 #include <queue>
 
 #include <TGUI/Container.hpp>
+#include <TGUI/InputRecording.hpp>
+#include <TGUI/MemoryStats.hpp>
+#include <TGUI/RenderStats.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,21 +47,21 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Default constructor
         ///
-        /// If you use this constructor then you will still have to call the setWindow yourself.
+        /// If you use this constructor then you will still have to call the setWindow or setTarget yourself.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Gui();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// \brief Construct the gui and set the window on which the gui should be drawn.
+        /// \brief Construct the gui and set the target on which the gui should be drawn.
         ///
-        /// \param window  The sfml window that will be used by the gui.
+        /// \param target  The sfml window or render texture that will be used by the gui.
         ///
         /// If you use this constructor then you will no longer have to call setWindow yourself.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Gui(sf::RenderWindow& window);
+        Gui(sf::RenderTarget& target);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,12 +76,34 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the window on which the gui is being drawn.
         ///
-        /// \return The sfml that is used by the gui.
+        /// \return The sfml window that is used by the gui, or nullptr when the gui is drawn on something else than a window.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         sf::RenderWindow* getWindow();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the target on which the gui should be drawn.
+        ///
+        /// \param target  The sfml window or render texture that will be used by the gui.
+        ///
+        /// By drawing on a render texture the gui can be used without a window, e.g. to render it on a machine without
+        /// a display. The mouse positions in the events that you pass to handleEvent are then mapped with the view of
+        /// the render texture, as if they were pixels on the texture.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTarget(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the target on which the gui is being drawn.
+        ///
+        /// \return The sfml window or render texture that is used by the gui.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::RenderTarget* getTarget();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Passes the event to the widgets.
         ///
@@ -100,6 +125,131 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the gui has to be drawn again.
+        ///
+        /// \return True when a widget changed since the last call to draw or when an animation has to be updated
+        ///
+        /// When this function returns false then the window still shows the current state of the gui, so you can skip
+        /// drawing the frame. Together with getTimeUntilNextUpdate this lets your application sleep while the gui is idle:
+        /// \code
+        /// if (gui.needsRedraw())
+        /// {
+        ///     window.clear();
+        ///     gui.draw();
+        ///     window.display();
+        /// }
+        /// \endcode
+        ///
+        /// When you draw other things in the window as well then you are still responsible for redrawing those yourself.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether only the changed parts of the gui are redrawn.
+        ///
+        /// \param enabled     Should only the areas of the changed widgets be redrawn?
+        /// \param background  The color behind the widgets
+        ///
+        /// When enabled, the gui is kept in a texture with the size of the window. Every call to draw will only redraw the
+        /// widgets that intersect with the areas of the widgets that changed, after which the texture is drawn on the window.
+        /// This is disabled by default.
+        ///
+        /// The texture is filled with the background color and replaces the contents of the window, so the gui looks exactly
+        /// like it would when the window was cleared with that color before drawing it. Things that you draw before the gui
+        /// will thus no longer be visible, only the things that you draw after it. The alpha of the color is ignored.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enablePartialRedraw(bool enabled, const sf::Color& background = sf::Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether only the changed parts of the gui are redrawn.
+        ///
+        /// \return Is partial redrawing enabled?
+        ///
+        /// \see enablePartialRedraw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Highlights the areas that were redrawn.
+        ///
+        /// \param show  Should the redrawn areas be shown?
+        ///
+        /// This is meant for debugging. When partial redrawing is enabled, every call to draw will draw a red rectangle
+        /// on top of the areas that had to be redrawn in that frame.
+        ///
+        /// \see enablePartialRedraw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void showDamagedAreas(bool show);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many widgets were skipped during the last draw because they weren't visible.
+        ///
+        /// \return Amount of widgets that were not drawn because they were outside the window or their parent,
+        ///         or because they were hidden behind an opaque widget
+        ///
+        /// The widgets inside a skipped container are not included in the count.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCulledWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether statistics are collected about every frame.
+        ///
+        /// \param enabled  Should the draw calls and the time spent inside the gui be counted?
+        ///
+        /// Collecting the statistics has a small cost, so this is disabled by default.
+        ///
+        /// \see getRenderStats
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableRenderStats(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the statistics about the last frame that was drawn.
+        ///
+        /// \return Statistics about the last frame
+        ///
+        /// A frame consists of the calls to handleEvent and updateTime since the previous frame, followed by the call to draw.
+        /// The statistics are only collected when enableRenderStats(true) was called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RenderStats& getRenderStats() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Shows the statistics of the previous frame in the top left corner of the window.
+        ///
+        /// \param show  Should the statistics be shown?
+        ///
+        /// This is meant for debugging. Showing the statistics will also enable collecting them.
+        /// The text is drawn with the global font, so make sure that a font has been set.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void showRenderStats(bool show);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how much memory is used by the widgets, the textures and the fonts.
+        ///
+        /// \return Memory per widget type, per texture, per font and per container
+        ///
+        /// The statistics are calculated when calling this function, so you shouldn't call it every frame.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryStats getMemoryStats() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the next callback from the callback queue.
         ///
@@ -150,7 +300,8 @@ namespace tgui
         ///
         /// This font will be used by all widgets that are created after calling this function.
         ///
-        /// \param font  Font to copy
+        /// \param font  Font to copy. When the font is the global font of another container (e.g. gui.getGlobalFont())
+        ///              then it is shared instead, together with the glyphs that were already rendered with it.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setGlobalFont(const sf::Font& font);
@@ -167,22 +318,35 @@ namespace tgui
         const sf::Font& getGlobalFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Renders the characters with the global font, so that they don't have to be rendered when they are drawn.
+        ///
+        /// \param characters      The characters that should be rendered.
+        /// \param characterSizes  The character sizes at which the characters should be rendered.
+        ///
+        /// Call this e.g. while showing a loading screen, after the global font was set.
+        /// See TGUI_FontManager.prewarm and TGUI_FontManager.enableGlyphTracking for more options.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarmGlyphs(const sf::String& characters, const std::vector<unsigned int>& characterSizes);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns a list of all the widgets.
         ///
-        /// \return Vector of all widget pointers
+        /// \return Vector of all widget pointers, ordered from the widget at the back to the one in front
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector< Widget::Ptr >& getWidgets();
+        const std::vector< Widget::Ptr >& getWidgets() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns a list of the names of all the widgets.
         ///
-        /// \return Vector of all widget names
+        /// \return Vector of all widget names, in the same order as the widgets returned by getWidgets
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector<sf::String>& getWidgetNames();
+        const std::vector<sf::String>& getWidgetNames() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +404,17 @@ namespace tgui
         Widget::Ptr copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Adds multiple widgets to the container at once.
+        ///
+        /// \param widgets      The widgets to add, they are placed on top of each other in the given order
+        /// \param widgetNames  The names of the widgets. When this list is shorter than the list of widgets then the
+        ///                     remaining widgets are added without a name.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addRange(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = std::vector<sf::String>());
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes a single widget that was added to the container.
         ///
@@ -266,6 +441,39 @@ namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all widgets for which the predicate returns true.
+        ///
+        /// \param predicate  Function that is called once for every widget, from back to front
+        ///
+        /// \return The amount of widgets that were removed
+        ///
+        /// All widgets are removed in a single pass, so this is a lot faster than removing them one by one.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int removeIf(const std::function<bool(const Widget::Ptr&)>& predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes multiple widgets at once.
+        ///
+        /// \param widgets  The widgets to remove. Widgets that are not part of the gui are ignored.
+        ///
+        /// All widgets are removed in a single pass, so this is a lot faster than removing them one by one.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeRange(const std::vector<Widget::Ptr>& widgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Reserves memory for the given amount of widgets.
+        ///
+        /// \param widgetCount  The amount of widgets that you are planning to add directly to the gui
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserve(unsigned int widgetCount);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Focuses an widget.
         ///
@@ -384,12 +592,106 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the internal clock to make animation possible. This function is called automatically by the draw function.
-        // You will thus only need to call it yourself when you are drawing everything manually.
+        // Update the internal clock to make animation possible. This function is called automatically by the draw function,
+        // unless a fixed time step was set. You will thus only need to call it yourself when you are drawing everything manually
+        // or when you want to decide yourself how much time passes for the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Updates the widgets with the time that passed on the clock since the previous update.
+        ///
+        /// \return How many times the widgets were updated
+        ///
+        /// Without a fixed time step, the widgets are updated once with all the time that passed.
+        /// With a fixed time step, the widgets are updated once for every full time step that passed and the remaining time
+        /// is kept for the next call. The draw function no longer updates the widgets in that case, so you can update and draw
+        /// at different rates:
+        /// \code
+        /// gui.setFixedTimeStep(sf::seconds(1.f / 60));
+        /// while (window.isOpen())
+        /// {
+        ///     // handle the events ...
+        ///     gui.update();
+        ///
+        ///     window.clear();
+        ///     gui.draw();
+        ///     window.display();
+        /// }
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int update();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the time step with which the widgets are updated.
+        ///
+        /// \param timeStep  The time that passes for the widgets in every update, or sf::Time::Zero to update them from the
+        ///                  draw function with the real elapsed time again (default). A negative time is treated as zero.
+        ///
+        /// When a time step is set, the widgets are only updated when you call update or updateTime. Every update then moves
+        /// the animations forward by exactly the same amount, which makes them independent of the frame rate.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFixedTimeStep(const sf::Time& timeStep);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the time step with which the widgets are updated.
+        ///
+        /// \return The fixed time step, or sf::Time::Zero when the widgets are updated from the draw function
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getFixedTimeStep() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how long it takes before a widget has to be updated again.
+        ///
+        /// \return Time until the next animation step, or a very large time when no widget is animating
+        ///
+        /// The time that passed since the last call to draw (or updateTime) is already taken into account.
+        /// This can be used to let your application sleep while nothing is changing, e.g. by waiting for an event
+        /// with a timeout.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the clock that is used to find out how much time passed between two calls to draw (or update).
+        ///
+        /// \param clock  The new clock, or nullptr to use the real time again.
+        ///
+        /// The gui does not take ownership of the clock, it has to stay alive as long as the gui uses it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClock(Clock* clock);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Starts recording the events, updates and frames of the gui into a file.
+        ///
+        /// \param filename  Filename of the recording.
+        ///
+        /// \return True when the file was created
+        ///
+        /// All events passed to handleEvent, the times passed to updateTime and the time between the calls to draw are written
+        /// to the file, until stopRecording is called. The recording can be played back with the InputReplay class.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool startRecording(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Stops recording and closes the file.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopRecording();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // TGUI uses this function internally to handle widget callbacks.
         // When you tell an widget to send its callbacks to its parent then this function is called.
@@ -402,21 +704,70 @@ namespace tgui
         void addChildCallback(const Callback& callback);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Redraws the areas of the changed widgets on the render texture and draws the texture on the window.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawDamagedAreas();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the window, either completely or only the damaged areas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes the OpenGL context of the target active. Needed because clipping is changed directly with OpenGL.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void activateTarget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the widgets, without recording the elapsed time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgets(const sf::Time& elapsedTime);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         // This will store all widget callbacks until you pop them with getCallback
         std::queue<Callback> m_Callback;
 
-        // The internal clock which is used for animation of widgets
-        sf::Clock m_Clock;
+        // The clock which is used for animation of widgets, it points to m_SystemClock unless another clock was set
+        SystemClock m_SystemClock;
+        Clock*      m_Clock;
+
+        // When the fixed time step is not zero then the widgets are only updated in steps of this size
+        sf::Time m_FixedTimeStep;
+        sf::Time m_AccumulatedTime;
 
-        // The sfml window
-        sf::RenderWindow* m_Window;
+        // Writes the events and frame times to a file while recording
+        InputRecorder m_Recorder;
+
+        // The sfml window or render texture on which the gui is drawn
+        sf::RenderTarget* m_Target;
 
         // Internal container to store all widgets
         GuiContainer m_Container;
 
+        // When partial redrawing is enabled then the gui is drawn on this texture and only the damaged areas are redrawn
+        bool                       m_PartialRedraw;
+        bool                       m_ShowDamagedAreas;
+        sf::Color                  m_PartialRedrawBackground;
+        sf::RenderTexture          m_RenderTexture;
+        std::vector<sf::FloatRect> m_DamagedAreas;
+
+        // The statistics of the frame that is being drawn and the statistics of the previous frame
+        bool               m_RenderStatsEnabled;
+        bool               m_ShowRenderStats;
+        RenderStats        m_RenderStats;
+        RenderStats        m_LastFrameStats;
+        RenderStatsOverlay m_RenderStatsOverlay;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_INPUT_RECORDING_HPP
+#define TGUI_INPUT_RECORDING_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <vector>
+
+#include <TGUI/Clock.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Gui;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Writes the events and frame times that the gui receives to a binary file.
+    ///
+    /// You don't have to use this class directly, just call startRecording on the gui.
+    /// The recording can be played back with the InputReplay class.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputRecorder : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Creates the file and writes the header.
+        ///
+        /// \param filename  Filename of the recording.
+        ///
+        /// \return True when the file was created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Closes the file.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the recorder is writing to a file.
+        ///
+        /// \return True between the calls to open and close
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOpen() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Records an event that was passed to Gui::handleEvent. Joystick events are ignored, the gui doesn't use them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addEvent(const sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Records the time that was passed to Gui::updateTime.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addUpdate(const sf::Time& elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Records a call to Gui::draw together with the time that passed since the previous frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFrame(const sf::Time& elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        std::ofstream m_File;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Plays back a recording that was made with Gui::startRecording.
+    ///
+    /// While replaying, the replay is used as the clock of the gui, so every frame sees exactly the same elapsed time as
+    /// during the recording. This makes it possible to replay the same session with different builds and compare the frame times:
+    /// \code
+    /// tgui::InputReplay replay;
+    /// if (replay.load("session.rec") && replay.replay(gui))
+    /// {
+    ///     for (unsigned int i = 0; i < replay.getFrameTimes().size(); ++i)
+    ///         std::cout << replay.getFrameTimes()[i].asMicroseconds() << std::endl;
+    /// }
+    /// \endcode
+    ///
+    /// The gui has to contain the same widgets as when the recording was made.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputReplay : public Clock
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Reads a recording.
+        ///
+        /// \param filename  Filename of the recording.
+        ///
+        /// \return True when the file was a valid recording
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool load(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Passes all recorded events and frames to the gui.
+        ///
+        /// \param gui  The gui that will receive the events.
+        ///
+        /// \return False when no recording was loaded
+        ///
+        /// The events are passed to handleEvent, the updates to updateTime and for every recorded frame the draw function of
+        /// the gui is called. The target of the gui is not cleared or displayed. The callbacks of the widgets are removed from
+        /// the callback queue after every event.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool replay(Gui& gui);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how long every call to Gui::draw took during the last replay.
+        ///
+        /// \return Duration of every recorded frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Time>& getFrameTimes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns zero, the time only moves forward when the next frame is replayed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getElapsedTime() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the recorded time of the frame that is being replayed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time restart();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // An event, a call to updateTime or a call to draw, in the order in which the gui received them
+        struct Record
+        {
+            sf::Uint8 type;
+            sf::Event event;
+            sf::Time  time;
+        };
+
+        std::vector<Record>   m_Records;
+        std::vector<sf::Time> m_FrameTimes;
+
+        // The elapsed time that will be returned by restart
+        sf::Time m_FrameTime;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_RECORDING_HPP
@@ -27,6 +27,8 @@
 #define TGUI_LIST_BOX_HPP
 
 
+#include <map>
+
 #include <TGUI/Widget.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,6 +255,15 @@ namespace tgui
         const sf::Font* getTextFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the character size of the items.
+        ///
+        /// \return The text size, which depends on the item height.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Adds an item to the list.
         ///
@@ -540,6 +551,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the vertices of the visible items are up to date and forgets the vertices of the other items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemVertices(unsigned int firstItem, unsigned int lastItem) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -586,6 +603,22 @@ namespace tgui
         // The font used to draw the text
         const sf::Font* m_TextFont;
 
+        // The text of the visible items is kept as vertices, so that the glyphs only have to be looked up when an item changes.
+        // The string is stored to find out whether the item at that index is still the same.
+        struct ItemVertices
+        {
+            sf::String      string;
+            sf::VertexArray vertices;
+            sf::FloatRect   bounds;
+        };
+
+        mutable std::map<unsigned int, ItemVertices> m_ItemVertices;
+        mutable const sf::Font*                      m_ItemVerticesFont;
+        mutable unsigned int                         m_ItemVerticesTextSize;
+
+        // The vertices of all visible items together, so that they can be drawn at once
+        mutable sf::VertexArray m_TextVertices;
+
         // ComboBox contains a list box internally and it should be able to adjust it.
         friend class ComboBox;
 
@@ -339,6 +339,10 @@ namespace tgui
         Texture  m_TextureFront_M;
         Texture  m_TextureFront_R;
 
+        // The L, M and R images combined in a single sprite when the image is split
+        NineSliceSprite m_SpriteBack;
+        NineSliceSprite m_SpriteFront;
+
         // The text that is (optionally) drawn on top of the loading bar
         sf::Text     m_Text;
         unsigned int m_TextSize;
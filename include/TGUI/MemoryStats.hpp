@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_MEMORY_STATS_HPP
+#define TGUI_MEMORY_STATS_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+#include <TGUI/Defines.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Container;
+    class Widget;
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory that is used by the widgets of a single type.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API WidgetTypeMemory
+    {
+        WidgetTypeMemory();
+
+        unsigned int widgets;
+        std::size_t  bytes;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory that is used by a texture that was loaded by the texture manager.
+    ///
+    /// The texture manager is shared by all guis, so the textures of other guis are included as well.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API TextureMemory
+    {
+        TextureMemory();
+
+        std::string  filename;
+        unsigned int users;
+        std::size_t  imageBytes;   // The alpha mask that is kept in memory to check for transparent pixels
+        std::size_t  textureBytes; // Estimate of the memory on the graphics card, assuming four bytes per pixel
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory that is used by the glyph cache of a font.
+    ///
+    /// SFML keeps a separate texture with glyphs for every character size. Only the character sizes that are used by the
+    /// text of the widgets can be found. The glyph textures of sizes at which the widgets didn't render any text yet are
+    /// not included.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API FontMemory
+    {
+        FontMemory();
+
+        unsigned int              widgets;
+        std::vector<unsigned int> characterSizes;
+        std::size_t               glyphBytes;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory that is used by a container and all widgets inside it.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API ContainerMemory
+    {
+        ContainerMemory();
+
+        std::string  name;    // Name of the container inside its parent, the gui itself is called "Gui"
+        WidgetTypes  type;    // Type_Unknown for the gui itself
+        unsigned int depth;   // 0 for the gui, 1 for the containers that were added directly to the gui, ...
+        unsigned int widgets; // All widgets inside the container, including the ones inside child containers
+        std::size_t  bytes;   // The container itself and all widgets inside it, without the textures and fonts
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory that is used by the gui, as returned by Gui::getMemoryStats.
+    ///
+    /// The memory of a widget is the size of the widget object itself. Memory that is allocated by the widget (e.g. for its
+    /// text or the items of a list box) is not counted. Textures and fonts are shared between widgets, so they are counted
+    /// separately.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API MemoryStats
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryStats();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Adds the memory of the widgets inside the container and of all textures in the texture manager.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collect(const Container& container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the memory that is used by the widgets, the textures and the glyph caches together.
+        ///
+        /// \return Total amount of bytes, including the estimated memory on the graphics card
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTotalBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets of the container and returns the amount of bytes that they use.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addContainer(const Container& container, unsigned int depth, unsigned int& widgetCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a widget to the statistics of its type and remembers its font. Returns the size of the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addWidget(const Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that a widget uses the font at the given character size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFont(const sf::Font* font, unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      public:
+
+        std::size_t widgetBytes;
+        std::size_t imageBytes;
+        std::size_t textureBytes;
+        std::size_t glyphBytes;
+
+        std::map<WidgetTypes, WidgetTypeMemory> widgetTypes;
+        std::map<const sf::Font*, FontMemory>   fonts;
+        std::vector<TextureMemory>              textures;
+        std::vector<ContainerMemory>            containers;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MEMORY_STATS_HPP
@@ -0,0 +1,179 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_NINE_SLICE_SPRITE_HPP
+#define TGUI_NINE_SLICE_SPRITE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    struct Texture;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Sprite that is made of three images so that it can be resized without stretching its borders.
+    ///
+    /// All parts are stored in a single vertex array, so the sprite is drawn with one draw call as long as all parts
+    /// are taken from the same texture.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API NineSliceSprite : public sf::Drawable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        NineSliceSprite();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Uses three separate images, like the _L, _M and _R images that are loaded from the config files.
+        ///
+        /// \param left      The left image (or the top image when \a vertical is true).
+        /// \param middle    The middle image, which will be stretched.
+        /// \param right     The right image (or the bottom image when \a vertical is true).
+        /// \param vertical  Are the images placed below each other instead of next to each other?
+        ///
+        /// The left and right images keep their ratio and are scaled to the height of the sprite
+        /// (or to the width of the sprite when the images are placed vertically).
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextures(const Texture& left, const Texture& middle, const Texture& right, bool vertical = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the position of the top left corner of the sprite.
+        ///
+        /// \param x  The new x position.
+        /// \param y  The new y position.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPosition(float x, float y);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the size of the sprite.
+        ///
+        /// \param width   The new width of the sprite.
+        /// \param height  The new height of the sprite.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(float width, float height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the size of the sprite.
+        ///
+        /// \return Size of the sprite
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Vector2f& getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Only draw the left part of the sprite.
+        ///
+        /// \param width  The width of the part that will be visible. Pass a negative value to show the entire sprite again.
+        ///
+        /// The parts that are cut off are not stretched, the sprite just stops at the given width.
+        /// By default the entire sprite is visible.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisibleWidth(float width);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the color of the sprite, which is multiplied with the color of the image.
+        ///
+        /// \param color  The new color of the sprite.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setColor(const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many draw calls are needed to draw the sprite.
+        ///
+        /// \return 1 when all parts share the same texture, otherwise one draw call per part is needed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the vertices after the position, size or images of the sprite changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the sprite.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        enum SliceMode
+        {
+            SliceMode_None,
+            SliceMode_Horizontal,
+            SliceMode_Vertical
+        };
+
+        SliceMode m_Mode;
+
+        // The texture of the left, middle and right part (top, middle and bottom part in vertical mode).
+        // Only when the three textures are the same can the sprite be drawn with a single draw call.
+        const sf::Texture* m_Textures[3];
+        bool               m_SharedTexture;
+
+        // The texture rectangle of every part, indexed by row and column
+        sf::FloatRect m_TextureRects[3][3];
+
+        sf::Vector2f m_Position;
+        sf::Vector2f m_Size;
+        sf::Color    m_Color;
+
+        // The width of the visible part, or a negative value when the whole sprite is visible
+        float        m_VisibleWidth;
+
+        // The vertices are grouped per texture (per column, or per row in vertical mode)
+        sf::Vertex   m_Vertices[36];
+        unsigned int m_VertexCounts[3];
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_NINE_SLICE_SPRITE_HPP
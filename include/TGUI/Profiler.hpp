@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Defines.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The profiling zones are only compiled in when tgui is build with the TGUI_ENABLE_PROFILING cmake option.
+// Only one zone can be placed in every scope and the name has to be a string that is never destroyed (e.g. a string literal).
+#ifdef TGUI_ENABLE_PROFILING
+    #define TGUI_PROFILE_ZONE(name)   tgui::ProfileZone tguiProfileZone(name)
+#else
+    #define TGUI_PROFILE_ZONE(name)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Records how long the profiling zones inside tgui took and saves them as a trace file.
+    ///
+    /// The zones are only recorded when tgui was build with the TGUI_ENABLE_PROFILING cmake option.
+    /// Every thread records into its own buffer, so recording a zone never has to wait for another thread.
+    ///
+    /// The trace can be opened in chrome (about:tracing) or in Perfetto to inspect the frames on a timeline:
+    /// \code
+    /// tgui::Profiler::saveChromeTrace("trace.json");
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether tgui was build with profiling enabled.
+        ///
+        /// \return True when the profiling zones are being recorded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Saves all recorded zones in the chrome trace event format.
+        ///
+        /// \param filename  Filename of the json file to write.
+        ///
+        /// \return
+        ///        - true when the file was written
+        ///        - false when profiling is disabled or when the file could not be opened
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool saveChromeTrace(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all recorded zones.
+        ///
+        /// This function should not be called while other threads are still using tgui.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the time in microseconds since the start of the program.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Int64 getTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Stores a zone in the buffer of the current thread. When the buffer is full then the zone is dropped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addZone(const char* name, sf::Int64 start, sf::Int64 end);
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Records the time between its construction and destruction. Use the TGUI_PROFILE_ZONE macro instead of this class.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ProfileZone : public sf::NonCopyable
+    {
+      public:
+
+        explicit ProfileZone(const char* name) :
+        m_Name (name),
+        m_Start(Profiler::getTime())
+        {
+        }
+
+        ~ProfileZone()
+        {
+            Profiler::addZone(m_Name, m_Start, Profiler::getTime());
+        }
+
+      private:
+
+        const char* m_Name;
+        sf::Int64   m_Start;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Checkbox.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -69,6 +70,13 @@ namespace tgui
         RadioButton& operator= (const RadioButton& right);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~RadioButton();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget by calling the copy constructor.
         // This function calls new and if you use this function then you are responsible for calling delete.
@@ -90,7 +98,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Checks the radio button.
         ///
-        /// It will tell its parent to uncheck all the other radio buttons.
+        /// The radio button that was checked before in the same group will be unchecked.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void check();
@@ -117,6 +125,57 @@ namespace tgui
         void forceUncheck();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the group of the radio button.
+        ///
+        /// \param group  The new group, or nullptr to use the group of the parent again
+        ///
+        /// By default all radio buttons inside the same container belong to the same group. Radio buttons that share a group
+        /// can be placed in different containers, only one of them will be checked at the same time.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGroup(const RadioButtonGroup::Ptr& group);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the group to which the radio button belongs.
+        ///
+        /// \return The group of the radio button, which is the group of its parent when no group was set
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButtonGroup::Ptr getGroup() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Makes the radio button use the group of its parent, unless it was given its own group.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void joinParentGroup();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Stops using the group of the parent when the radio button is removed from it. A group set by the user is kept.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leaveParentGroup();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // This function is called when the widget is added to a container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void initialize(Container *const container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the radio button to another group. When it is checked it will uncheck the radio button in the new group.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeGroup(const RadioButtonGroup::Ptr& group);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       public:
 
@@ -129,6 +188,16 @@ namespace tgui
             RadioButtonCallbacksCount = CheckboxCallbacksCount
         };
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // The group to which this radio button belongs
+        RadioButtonGroup::Ptr m_Group;
+
+        // Was the group set by the user instead of taken from the parent?
+        bool m_CustomGroup;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
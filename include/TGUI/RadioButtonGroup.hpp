@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RADIO_BUTTON_GROUP_HPP
+#define TGUI_RADIO_BUTTON_GROUP_HPP
+
+#include <memory>
+
+#include <TGUI/Defines.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class RadioButton;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Group of radio buttons of which only one can be checked at the same time.
+    ///
+    /// Every container has a group that is used by the radio buttons inside it, but you can create your own group and
+    /// give it to radio buttons in different containers to make them work together.
+    ///
+    /// The group remembers which radio button is checked, so checking another radio button doesn't require searching.
+    ///
+    /// Usage example:
+    /// \code
+    /// tgui::RadioButtonGroup::Ptr group = tgui::RadioButtonGroup::create();
+    /// radioButton1->setGroup(group);
+    /// radioButton2->setGroup(group); // radioButton2 can be inside another panel
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RadioButtonGroup
+    {
+      public:
+
+        typedef std::shared_ptr<RadioButtonGroup> Ptr;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Creates a new empty group.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Unchecks the radio button that is currently checked in this group.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uncheck();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the radio button that is currently checked in this group.
+        ///
+        /// \return The checked radio button, or nullptr when none of the radio buttons is checked
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButton* getCheckedRadioButton() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Called by the radio button when it gets checked. The previously checked radio button will be unchecked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void radioButtonChecked(RadioButton* radioButton);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Called by the radio button when it gets unchecked, removed from the group or destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void radioButtonUnchecked(RadioButton* radioButton);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        RadioButtonGroup();
+
+        // The group is shared and can't be copied
+        RadioButtonGroup(const RadioButtonGroup&);
+        RadioButtonGroup& operator=(const RadioButtonGroup&);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        RadioButton* m_CheckedRadioButton;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RADIO_BUTTON_GROUP_HPP
@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDER_STATS_HPP
+#define TGUI_RENDER_STATS_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+
+#include <TGUI/Defines.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Statistics about the widgets of a single type that were drawn during a frame.
+    ///
+    /// The draw calls and draw time of a container include the widgets inside it.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API WidgetTypeStats
+    {
+        WidgetTypeStats();
+
+        unsigned int widgets;
+        unsigned int drawCalls;
+        sf::Time     drawTime;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Statistics about a single frame, collected by the gui when enableRenderStats(true) was called.
+    ///
+    /// SFML does not report what it sends to the graphics card, so the draw calls, vertices and texture binds are counted
+    /// from the draw calls that are made by the widgets.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API RenderStats
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RenderStats();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Sets all counters back to zero.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reset();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Counts a single draw call with the given amount of vertices.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDrawCall(const sf::Texture* texture, unsigned int vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Counts the draw calls that are needed to draw the sprite, text, shape or vertex array.
+        // Other drawables (like the NineSliceSprite) have to report their own draw calls.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDrawable(const sf::Drawable& drawable, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the name of the widget type, as used in the statistics overlay.
+        ///
+        /// \param type  The type of the widget.
+        ///
+        /// \return Name of the widget type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const char* getTypeName(WidgetTypes type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int drawCalls;
+        unsigned int vertices;
+        unsigned int textureBinds;
+        unsigned int scissorChanges;
+
+        unsigned int widgetsVisited;
+        unsigned int widgetsCulled;
+
+        sf::Time     handleEventTime;
+        sf::Time     updateTime;
+        sf::Time     drawTime;
+
+        std::map<WidgetTypes, WidgetTypeStats> widgetTypes;
+
+        // The texture that was used in the last draw call, to find out when a different texture gets bound
+        const sf::Texture* lastTexture;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Shows the render statistics of the previous frame on top of the gui.
+    ///
+    /// You don't have to use this class directly, just call showRenderStats(true) on the gui.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderStatsOverlay : public sf::Drawable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RenderStatsOverlay();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the font of the text.
+        ///
+        /// \param font  The new font.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextFont(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the statistics that are displayed.
+        ///
+        /// \param stats  The statistics of the last frame.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setStats(const RenderStats& stats);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the background and the text in the top left corner of the target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        sf::Text           m_Text;
+        sf::RectangleShape m_Background;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /// The statistics of the frame that is being drawn, or a null pointer when no statistics are being collected.
+    extern TGUI_API RenderStats* TGUI_RenderStats;
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Draws the drawable on the target and counts the draw call when render statistics are being collected.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void drawCounted(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Changes the clipping area with glScissor and counts the change when render statistics are being collected.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void setScissor(int x, int y, int width, int height);
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_STATS_HPP
@@ -304,6 +304,11 @@ namespace tgui
         Texture m_TextureTrackHover_R;
         Texture m_TextureThumbNormal;
         Texture m_TextureThumbHover;
+
+        // The L, M and R images of the track combined in a single sprite when the image is split.
+        // The sprites are resized while drawing as they lie in the direction of the image and not of the slider.
+        mutable NineSliceSprite m_SpriteTrackNormal;
+        mutable NineSliceSprite m_SpriteTrackHover;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
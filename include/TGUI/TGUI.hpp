@@ -34,6 +34,7 @@
 #include <TGUI/Button.hpp>
 #include <TGUI/Checkbox.hpp>
 #include <TGUI/RadioButton.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
 #include <TGUI/EditBox.hpp>
 #include <TGUI/Slider.hpp>
 #include <TGUI/Scrollbar.hpp>
@@ -55,6 +56,7 @@
 #include <TGUI/MessageBox.hpp>
 #include <TGUI/Grid.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <TGUI/SharedWidgetPtr.inl>
 
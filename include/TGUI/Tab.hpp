@@ -438,6 +438,11 @@ namespace tgui
         Texture  m_TextureSelected_M;
         Texture  m_TextureSelected_R;
 
+        // The L, M and R images combined in a single sprite when the image is split.
+        // The same sprites are used for all tabs, they are resized to the width of the tab while drawing.
+        mutable NineSliceSprite m_SpriteNormal;
+        mutable NineSliceSprite m_SpriteSelected;
+
         sf::Text      m_Text;
 
 
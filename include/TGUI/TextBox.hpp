@@ -442,6 +442,7 @@ namespace tgui
         virtual void mouseWheelMoved(int delta);
         virtual void mouseNotOnWidget();
         virtual void mouseNoLongerDown();
+        virtual void widgetFocused();
         virtual void widgetUnfocused();
 
 
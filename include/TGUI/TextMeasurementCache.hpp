@@ -0,0 +1,207 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_MEASUREMENT_CACHE_HPP
+#define TGUI_TEXT_MEASUREMENT_CACHE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <list>
+#include <map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct TextMeasurement
+    {
+        // The font, character size and style with which the string was measured
+        const sf::Font* font;
+        unsigned int    characterSize;
+        sf::Uint32      style;
+        sf::String      string;
+
+        // The local bounds of the text
+        sf::FloatRect bounds;
+
+        // Position of every character relative to the text, plus the position behind the last character.
+        // This is only filled the first time a character position is requested.
+        std::vector<sf::Vector2f> characterPositions;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    class TGUI_API TextMeasurementCache : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextMeasurementCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the local bounds of the text, like sf::Text::getLocalBounds does.
+        ///
+        /// \param text  The text to measure.
+        ///
+        /// \return Bounds of the text, without its transformation
+        ///
+        /// Texts with the same font, character size, style and string share the same measurement, so e.g. the items of a
+        /// list box are only measured once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getLocalBounds(const sf::Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the global bounds of the text, like sf::Text::getGlobalBounds does.
+        ///
+        /// \param text  The text to measure.
+        ///
+        /// \return Bounds of the text, with its transformation
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getGlobalBounds(const sf::Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the position of a character, like sf::Text::findCharacterPos does.
+        ///
+        /// \param text   The text that contains the character.
+        /// \param index  Index of the character. When it is too high, the position behind the last character is returned.
+        ///
+        /// \return Position of the character, with the transformation of the text
+        ///
+        /// The positions of all characters are calculated in a single pass and are then kept. Every call still has to look up
+        /// the string in the cache though, so use getCharacterPositions when looping over the characters.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f findCharacterPos(const sf::Text& text, std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the positions of all characters in the text.
+        ///
+        /// \param text  The text that contains the characters.
+        ///
+        /// \return Position of every character plus the position behind the last character, without the transformation of the text
+        ///
+        /// The returned positions stay valid until the cache is used again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Vector2f>& getCharacterPositions(const sf::Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the amount of measurements that are kept.
+        ///
+        /// \param capacity  Maximum amount of different strings that are remembered (1024 by default).
+        ///
+        /// When the cache is full then the measurement that wasn't used for the longest time is removed.
+        /// A capacity of 0 is treated as 1, as the measurement that was made last is always kept.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCapacity(unsigned int capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of measurements that are kept.
+        ///
+        /// \return Maximum amount of different strings that are remembered
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCapacity() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes all measurements.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes the measurements that were made with the font.
+        ///
+        /// \param font  The font that is about to be destroyed.
+        ///
+        /// The font manager calls this function itself. When you destroy a font that you passed to a widget yourself,
+        /// call this function (or clear) first, as another font could later be created at the same address.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFont(const sf::Font* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the measurement of the text, after measuring it when it wasn't in the cache yet.
+        // The returned measurement stays valid until the next call to this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextMeasurement& getMeasurement(const sf::Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the positions of all characters in the same way as sf::Text does.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateCharacterPositions(TextMeasurement& measurement);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        struct Key
+        {
+            bool operator<(const Key& right) const;
+
+            const sf::Font* font;
+            unsigned int    characterSize;
+            sf::Uint32      style;
+            std::size_t     length;
+            sf::Uint32      hash;
+        };
+
+        // The most recently used measurement is at the front of the list
+        std::list<TextMeasurement>                                   m_Measurements;
+        std::map<Key, std::list<TextMeasurement>::iterator>          m_Index;
+        unsigned int                                                 m_Capacity;
+
+        // Positions that are returned for a text without a font
+        std::vector<sf::Vector2f>                                    m_EmptyPositions;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_MEASUREMENT_CACHE_HPP
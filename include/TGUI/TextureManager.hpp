@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <list>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -38,10 +39,14 @@ namespace tgui
 
     struct TextureData
     {
-        sf::Image     image;
         sf::Texture   texture;
         std::string   filename;
         unsigned int  users;
+
+        // One bit per pixel that is set when the pixel is not fully transparent, every row starts at a new 32-bit word.
+        // Only this mask is kept after the image was uploaded to the graphics card.
+        std::vector<sf::Uint32> alphaMask;
+        unsigned int            alphaMaskRowWords;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +111,24 @@ namespace tgui
         void removeTexture(Texture& textureToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns all textures that are currently loaded.
+        ///
+        /// \return List of the loaded textures, with the amount of places where they are used
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::list<TextureData>& getTextureData() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the alpha mask of the texture data with the transparency of the pixels in the image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createAlphaMask(const sf::Image& image, TextureData& data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -269,6 +269,69 @@ namespace tgui
         virtual void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Set the position of the widget
+        ///
+        /// This function completely overwrites the previous position.
+        /// See the move function to apply an offset based on the previous position instead.
+        /// The default position of a transformable widget is (0, 0).
+        ///
+        /// \param x X coordinate of the new position
+        /// \param y Y coordinate of the new position
+        ///
+        /// \see move, getPosition
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPosition(float x, float y);
+        using Transformable::setPosition;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the gui that the widget has changed and has to be drawn again.
+        ///
+        /// All functions that change the looks of the widget already call this function, so you will only need it when
+        /// you have written your own widget. The parent of the widget is marked as changed as well.
+        ///
+        /// \see isDirty
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markDirty();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the widget has changed since the last time the gui was drawn.
+        ///
+        /// \return Has the widget been changed?
+        ///
+        /// \see markDirty
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDirty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the size of the area in which the widget draws.
+        ///
+        /// \return Size of the widget, including parts like the title bar of a child window
+        ///
+        /// For most widgets this is the same as the size returned by getSize.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getFullSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the part of the widget that is completely opaque.
+        ///
+        /// \return Area, relative to the position of the widget, that hides everything behind it
+        ///
+        /// Containers don't draw the widgets that are completely hidden behind the opaque area of another widget.
+        /// By default, widgets return an empty rectangle.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getOpaqueArea() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the callback id of the widget.
         ///
@@ -297,11 +360,32 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called right after the elapsed time is changed.
-        // The elapsed time is only changed when the widget has set m_AnimatedWidget to true.
+        // The elapsed time is only changed when the widget asked to be updated with scheduleUpdate, or every frame when the
+        // widget has set m_AnimatedWidget to true.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks the parent to call the update function after the given time. An earlier request is replaced.
+        // The time between the first request and the update is added to m_AnimationTimeElapsed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(const sf::Time& delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Cancels the request made with scheduleUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelScheduledUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the area of the widget as changed without its contents having to be redrawn, e.g. when only the way in which
+        // a cached container is blended with the widgets behind it has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // The widgets use this function to send their callbacks to their parent and/or to a callback function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -352,7 +436,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      private:
+      protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the widget is added to a container.
@@ -409,7 +493,7 @@ namespace tgui
         // Can the widget be focused?
         bool m_AllowFocus;
 
-        // Keep track of the elapsed time.
+        // Keep track of the elapsed time. Widgets that set m_AnimatedWidget to true are updated every frame.
         bool m_AnimatedWidget;
         sf::Time m_AnimationTimeElapsed;
 
@@ -419,6 +503,15 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_ContainerWidget;
 
+        // The place where the widget is stored inside the event manager of its parent
+        unsigned int m_EntryIndex;
+
+        // Does the widget or one of its children have to be redrawn? When this is true then the parent is also dirty.
+        // The area of the widget has changed when m_Changed is set. The parent will however only have m_Changed set
+        // when its own looks changed and not just those of its child.
+        bool m_Dirty;
+        bool m_Changed;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
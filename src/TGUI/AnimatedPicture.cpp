@@ -24,6 +24,8 @@
 
 
 #include <TGUI/AnimatedPicture.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,7 +41,6 @@ namespace tgui
     m_Looping        (false)
     {
         m_Callback.widgetType = Type_AnimatedPicture;
-        m_AnimatedWidget = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -110,6 +111,8 @@ namespace tgui
         if (filename.empty() == true)
             return false;
 
+        markDirty();
+
         Texture tempTexture;
 
         // Try to load the texture from the file
@@ -142,6 +145,8 @@ namespace tgui
 
     void AnimatedPicture::setSize(float width, float height)
     {
+        markDirty();
+
         m_Size.x = width;
         m_Size.y = height;
     }
@@ -168,7 +173,9 @@ namespace tgui
         m_Playing = true;
 
         // Reset the elapsed time
+        cancelScheduledUpdate();
         m_AnimationTimeElapsed = sf::Time();
+        scheduleNextFrame();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,13 +183,17 @@ namespace tgui
     void AnimatedPicture::pause()
     {
         m_Playing = false;
+        cancelScheduledUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void AnimatedPicture::stop()
     {
+        markDirty();
+
         m_Playing = false;
+        cancelScheduledUpdate();
 
         if (m_Textures.empty())
             m_CurrentFrame = -1;
@@ -194,6 +205,8 @@ namespace tgui
 
     bool AnimatedPicture::setFrame(unsigned int frame)
     {
+        markDirty();
+
         // Check if there are no frames
         if (m_Textures.empty() == true)
         {
@@ -211,6 +224,7 @@ namespace tgui
 
         // The frame number isn't too high
         m_CurrentFrame = frame;
+        scheduleNextFrame();
         return true;
     }
 
@@ -249,6 +263,8 @@ namespace tgui
         if (frame >= m_Textures.size())
             return false;
 
+        markDirty();
+
         // Remove the requested frame
         TGUI_TextureManager.removeTexture(m_Textures[frame]);
         m_Textures.erase(m_Textures.begin() + frame);
@@ -269,6 +285,8 @@ namespace tgui
 
     void AnimatedPicture::removeAllFrames()
     {
+        markDirty();
+
         // Remove the textures (if we are the only one using it)
         for (unsigned int i=0; i< m_Textures.size(); ++i)
             TGUI_TextureManager.removeTexture(m_Textures[i]);
@@ -286,6 +304,8 @@ namespace tgui
 
     void AnimatedPicture::setLooping(bool loop)
     {
+        markDirty();
+
         m_Looping = loop;
     }
 
@@ -307,6 +327,8 @@ namespace tgui
 
     void AnimatedPicture::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         for (unsigned int i = 0; i < m_Textures.size(); ++i)
@@ -322,7 +344,10 @@ namespace tgui
             if (property == "Playing")
             {
                 if ((value == "true") || (value == "True"))
+                {
                     m_Playing = true;
+                    scheduleNextFrame();
+                }
                 else if ((value == "false") || (value == "False"))
                     m_Playing = false;
                 else
@@ -381,6 +406,7 @@ namespace tgui
                 m_AnimationTimeElapsed -= m_FrameDuration[m_CurrentFrame];
 
                 // Make the next frame visible
+                markDirty();
                 if (static_cast<unsigned int>(m_CurrentFrame + 1) < m_Textures.size())
                     ++m_CurrentFrame;
                 else
@@ -407,17 +433,45 @@ namespace tgui
             else // The frame has to remain visible
                 m_AnimationTimeElapsed = sf::Time();
         }
+
+        scheduleNextFrame();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimatedPicture::initialize(Container *const parent)
+    {
+        ClickableWidget::initialize(parent);
+
+        // Continue playing inside the new parent
+        scheduleNextFrame();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimatedPicture::scheduleNextFrame()
+    {
+        // A frame without duration remains visible, so no update is needed
+        if ((m_Playing) && (m_CurrentFrame >= 0) && (m_FrameDuration[m_CurrentFrame] > sf::Time()))
+        {
+            if (m_AnimationTimeElapsed < m_FrameDuration[m_CurrentFrame])
+                scheduleUpdate(m_FrameDuration[m_CurrentFrame] - m_AnimationTimeElapsed);
+            else
+                scheduleUpdate(sf::Time());
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void AnimatedPicture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("AnimatedPicture::draw");
+
         if (m_Loaded)
         {
             states.transform *= getTransform();
             states.transform.scale(m_Size.x / m_Textures[m_CurrentFrame].getSize().x, m_Size.y / m_Textures[m_CurrentFrame].getSize().y);
-            target.draw(m_Textures[m_CurrentFrame], states);
+            drawCounted(target, m_Textures[m_CurrentFrame], states);
         }
     }
 
@@ -0,0 +1,53 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BENCHMARK_COMMON_HPP
+#define TGUI_BENCHMARK_COMMON_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/TGUI.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The paths are relative to a folder inside the examples folder, just like in the examples
+#define THEME_CONFIG_FILE "../../widgets/Black.conf"
+#define FONT_FILE         "../../fonts/DejaVuSans.ttf"
+#define FORM_FILE         "../LoadFromFile/form.txt"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Adds the widgets of the FullExample to the gui, in the state that is shown on its Expected_Output.png.
+// The texture of the panel has to stay alive as long as the widgets are in the gui.
+bool createFullExample(tgui::Gui& gui, sf::Texture& panelTexture);
+
+// Writes the amount of samples, the mean, min, p50, p90, p99 and max of the timings (in milliseconds) as json members
+void writeTimings(std::ostream& stream, std::vector<double> samples);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BENCHMARK_COMMON_HPP
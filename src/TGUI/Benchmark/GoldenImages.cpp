@@ -0,0 +1,332 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Common.hpp"
+
+#include <SFML/OpenGL.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int TargetWidth = 800;
+    const unsigned int TargetHeight = 600;
+
+    // The largest possible difference between two colors in the YIQ color space, as calculated by getColorDifference
+    const double MaxColorDifference = 35215;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Form
+    {
+        const char* name;
+        bool (*create)(tgui::Gui& gui, sf::Texture& texture);
+        const char* goldenImage;
+    };
+
+    struct Result
+    {
+        std::string         name;
+        std::string         status;
+        unsigned int        differentPixels;
+        double              differentPercentage;
+        sf::Vector2u        offset;
+        std::vector<double> samples; // In milliseconds
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool loadFormFile(tgui::Gui& gui, sf::Texture&)
+    {
+        return gui.loadWidgetsFromFile(FORM_FILE);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The golden images are stored next to the examples. The one from the FullExample is a screenshot of the window,
+    // it is larger than the rendered image because it still contains the borders of the window.
+    const Form forms[] =
+    {
+        {"FullExample", &createFullExample, "../FullExample/Expected_Output.png"},
+        {"LoadFromFile", &loadFormFile, "../LoadFromFile/Expected_Output.png"}
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Returns the squared distance between the colors in the YIQ color space, which is closer to how humans see
+    // the difference between two colors than comparing the red, green and blue values separately
+    double getColorDifference(const sf::Color& color1, const sf::Color& color2)
+    {
+        const double r = color1.r - color2.r;
+        const double g = color1.g - color2.g;
+        const double b = color1.b - color2.b;
+
+        const double y = r * 0.29889531 + g * 0.58662247 + b * 0.11448223;
+        const double i = r * 0.59597799 - g * 0.27417610 - b * 0.32180189;
+        const double q = r * 0.21147017 - g * 0.52261711 + b * 0.31114694;
+
+        return 0.5053 * y * y + 0.299 * i * i + 0.1957 * q * q;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Counts the pixels that differ more than the threshold when the image is placed at the offset inside the golden image.
+    // Only every step'th pixel is compared, which is used to quickly find the offset.
+    unsigned int countDifferentPixels(const sf::Image& image, const sf::Image& golden, const sf::Vector2u& offset,
+                                      double maxDifference, unsigned int step, sf::Image* diffImage)
+    {
+        unsigned int count = 0;
+        for (unsigned int y = 0; y < image.getSize().y; y += step)
+        {
+            for (unsigned int x = 0; x < image.getSize().x; x += step)
+            {
+                const sf::Color goldenColor = golden.getPixel(x + offset.x, y + offset.y);
+                if (getColorDifference(image.getPixel(x, y), goldenColor) > maxDifference)
+                {
+                    ++count;
+                    if (diffImage)
+                        diffImage->setPixel(x, y, sf::Color::Red);
+                }
+                else if (diffImage)
+                {
+                    // The pixels that match are shown faded, so that the differences stand out
+                    const sf::Uint8 gray = static_cast<sf::Uint8>(128 + (goldenColor.r + goldenColor.g + goldenColor.b) / 6);
+                    diffImage->setPixel(x, y, sf::Color(gray, gray, gray));
+                }
+            }
+        }
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Finds the position of the image inside the golden image where the least pixels are different
+    sf::Vector2u findBestOffset(const sf::Image& image, const sf::Image& golden, double maxDifference)
+    {
+        sf::Vector2u bestOffset;
+        unsigned int bestCount = 0;
+        bool first = true;
+
+        for (unsigned int y = 0; y + image.getSize().y <= golden.getSize().y; ++y)
+        {
+            for (unsigned int x = 0; x + image.getSize().x <= golden.getSize().x; ++x)
+            {
+                const unsigned int count = countDifferentPixels(image, golden, sf::Vector2u(x, y), maxDifference, 4, nullptr);
+                if (first || (count < bestCount))
+                {
+                    bestOffset = sf::Vector2u(x, y);
+                    bestCount = count;
+                    first = false;
+                }
+            }
+        }
+
+        return bestOffset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void render(tgui::Gui& gui, sf::RenderTexture& target)
+    {
+        target.clear();
+        gui.draw();
+        target.display();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeJson(std::ostream& stream, const std::vector<Result>& results)
+    {
+        stream << std::fixed << std::setprecision(4);
+        stream << "{\n"
+               << "  \"tgui_version\": \"" << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n"
+               << "  \"unit\": \"ms\",\n"
+               << "  \"forms\": [";
+
+        for (std::vector<Result>::const_iterator it = results.begin(); it != results.end(); ++it)
+        {
+            stream << ((it == results.begin()) ? "\n" : ",\n")
+                   << "    {\"name\": \"" << it->name << "\""
+                   << ", \"status\": \"" << it->status << "\""
+                   << ", \"different_pixels\": " << it->differentPixels
+                   << ", \"different_percentage\": " << it->differentPercentage
+                   << ", \"offset\": [" << it->offset.x << ", " << it->offset.y << "], ";
+
+            writeTimings(stream, it->samples);
+            stream << "}";
+        }
+
+        stream << "\n  ]\n}\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::string outputFile;
+    double threshold = 0.1;
+    double tolerance = 0.5;
+    unsigned int samples = 20;
+    bool update = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+            outputFile = argv[++i];
+        else if ((std::strcmp(argv[i], "--threshold") == 0) && (i + 1 < argc))
+            threshold = std::atof(argv[++i]);
+        else if ((std::strcmp(argv[i], "--tolerance") == 0) && (i + 1 < argc))
+            tolerance = std::atof(argv[++i]);
+        else if ((std::strcmp(argv[i], "--samples") == 0) && (i + 1 < argc))
+            samples = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--update") == 0)
+            update = true;
+        else
+        {
+            std::cerr << "Usage: tgui-golden [--output file.json] [--threshold 0.1] [--tolerance 0.5] [--samples count] [--update]" << std::endl
+                      << "  --threshold  How different a pixel may be before it counts as different (0 to 1)" << std::endl
+                      << "  --tolerance  Percentage of the pixels that may be different" << std::endl
+                      << "  --update     Replace the golden images with the rendered images" << std::endl
+                      << "The program has to be started from a folder inside the examples folder." << std::endl;
+            return 1;
+        }
+    }
+
+    // The maximum difference is compared with the squared distance between the colors
+    const double maxDifference = threshold * threshold * MaxColorDifference;
+
+    sf::RenderTexture target;
+    if (!target.create(TargetWidth, TargetHeight))
+    {
+        std::cerr << "Failed to create the render texture." << std::endl;
+        return 1;
+    }
+
+    std::vector<Result> results;
+    bool success = true;
+    for (unsigned int i = 0; i < sizeof(forms) / sizeof(forms[0]); ++i)
+    {
+        Result result;
+        result.name = forms[i].name;
+        result.differentPixels = 0;
+        result.differentPercentage = 0;
+
+        // Every form gets a new gui, so that nothing is left behind from the previous form
+        tgui::Gui gui(target);
+        sf::Texture texture;
+
+        // The widgets are only updated when asked for, so that e.g. a blinking text cursor looks the same in every render
+        gui.setFixedTimeStep(sf::milliseconds(10));
+
+        if (!gui.setGlobalFont(FONT_FILE) || !forms[i].create(gui, texture))
+        {
+            std::cerr << "Failed to create " << result.name << ", make sure to start the program from a folder inside the examples folder." << std::endl;
+            result.status = "error";
+            results.push_back(result);
+            success = false;
+            continue;
+        }
+
+        render(gui, target);
+        const sf::Image image = target.getTexture().copyToImage();
+
+        // Measure how long it takes to render the form
+        for (unsigned int j = 0; j < samples; ++j)
+        {
+            sf::Clock clock;
+            render(gui, target);
+            glFinish();
+            result.samples.push_back(clock.getElapsedTime().asMicroseconds() / 1000.0);
+        }
+
+        sf::Image golden;
+        if (update)
+        {
+            result.status = image.saveToFile(forms[i].goldenImage) ? "updated" : "error";
+        }
+        else if (!golden.loadFromFile(forms[i].goldenImage))
+        {
+            // A form without golden image can't fail, the image can be created with --update
+            result.status = "skipped";
+            std::cerr << "No golden image found for " << result.name << ", run with --update to create " << forms[i].goldenImage << std::endl;
+        }
+        else if ((golden.getSize().x < image.getSize().x) || (golden.getSize().y < image.getSize().y))
+        {
+            result.status = "size mismatch";
+        }
+        else
+        {
+            result.offset = findBestOffset(image, golden, maxDifference);
+
+            sf::Image diffImage;
+            diffImage.create(image.getSize().x, image.getSize().y);
+
+            result.differentPixels = countDifferentPixels(image, golden, result.offset, maxDifference, 1, &diffImage);
+            result.differentPercentage = 100.0 * result.differentPixels / (image.getSize().x * image.getSize().y);
+
+            if (result.differentPercentage <= tolerance)
+                result.status = "passed";
+            else
+            {
+                result.status = "failed";
+
+                // Keep the images, so that the differences can be inspected
+                image.saveToFile(result.name + "_Output.png");
+                diffImage.saveToFile(result.name + "_Diff.png");
+            }
+        }
+
+        if ((result.status != "passed") && (result.status != "updated") && (result.status != "skipped"))
+            success = false;
+
+        std::cerr << result.name << ": " << result.status << std::endl;
+        results.push_back(result);
+    }
+
+    if (outputFile.empty())
+        writeJson(std::cout, results);
+    else
+    {
+        std::ofstream file(outputFile.c_str());
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open " << outputFile << std::endl;
+            return 1;
+        }
+
+        writeJson(file, results);
+    }
+
+    return success ? 0 : 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,408 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Common.hpp"
+
+#include <SFML/OpenGL.hpp>
+
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int TargetWidth = 800;
+    const unsigned int TargetHeight = 600;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Result
+    {
+        std::string         name;
+        std::vector<double> samples; // In milliseconds
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Every scenario prepares the gui, then measures the work function a number of times
+    class Scenario
+    {
+    public:
+
+        Scenario(const std::string& name, unsigned int defaultSamples) :
+        m_Name          (name),
+        m_DefaultSamples(defaultSamples)
+        {
+        }
+
+        virtual ~Scenario() {}
+
+        const std::string& getName() const { return m_Name; }
+
+        unsigned int getDefaultSamples() const { return m_DefaultSamples; }
+
+        virtual bool setUp(tgui::Gui& gui) = 0;
+
+        virtual void run(tgui::Gui& gui) = 0;
+
+        virtual void tearDown(tgui::Gui& gui) { gui.removeAllWidgets(); }
+
+    private:
+
+        std::string  m_Name;
+        unsigned int m_DefaultSamples;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Loads the form from the LoadFromFile example
+    class LoadFormScenario : public Scenario
+    {
+    public:
+
+        LoadFormScenario() : Scenario("load_form", 50) {}
+
+        virtual bool setUp(tgui::Gui&) { return true; }
+
+        virtual void run(tgui::Gui& gui)
+        {
+            gui.removeAllWidgets();
+            gui.loadWidgetsFromFile(FORM_FILE);
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Creates ten thousand buttons and removes them again
+    class CreateButtonsScenario : public Scenario
+    {
+    public:
+
+        CreateButtonsScenario() : Scenario("create_destroy_10k_buttons", 5) {}
+
+        virtual bool setUp(tgui::Gui&) { return true; }
+
+        virtual void run(tgui::Gui& gui)
+        {
+            for (unsigned int i = 0; i < 10000; ++i)
+            {
+                tgui::Button::Ptr button(gui);
+                button->load(THEME_CONFIG_FILE);
+                button->setPosition(static_cast<float>(i % 100) * 8, static_cast<float>(i / 100) * 6);
+                button->setSize(8, 6);
+            }
+
+            gui.removeAllWidgets();
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Moves the mouse over every cell of a grid of two thousand buttons
+    class MouseSweepScenario : public Scenario
+    {
+    public:
+
+        MouseSweepScenario() : Scenario("mouse_sweep_2k_widgets", 20) {}
+
+        virtual bool setUp(tgui::Gui& gui)
+        {
+            for (unsigned int row = 0; row < 40; ++row)
+            {
+                for (unsigned int column = 0; column < 50; ++column)
+                {
+                    tgui::Button::Ptr button(gui);
+                    if (!button->load(THEME_CONFIG_FILE))
+                        return false;
+
+                    button->setPosition(column * 16.f, row * 15.f);
+                    button->setSize(16, 15);
+                }
+            }
+
+            return true;
+        }
+
+        virtual void run(tgui::Gui& gui)
+        {
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+
+            for (unsigned int y = 0; y < TargetHeight; y += 5)
+            {
+                for (unsigned int x = 0; x < TargetWidth; x += 4)
+                {
+                    event.mouseMove.x = x;
+                    event.mouseMove.y = y;
+                    gui.handleEvent(event);
+                }
+            }
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Types a hundred characters at the end of a text box that already contains 100 KB of text
+    class TypingScenario : public Scenario
+    {
+    public:
+
+        TypingScenario() : Scenario("type_in_100kb_textbox", 10) {}
+
+        virtual bool setUp(tgui::Gui& gui)
+        {
+            tgui::TextBox::Ptr textBox(gui);
+            if (!textBox->load(THEME_CONFIG_FILE))
+                return false;
+
+            textBox->setPosition(0, 0);
+            textBox->setSize(static_cast<float>(TargetWidth), static_cast<float>(TargetHeight));
+
+            std::string text;
+            const std::string line = "The quick brown fox jumps over the lazy dog. 0123456789\n";
+            while (text.length() + line.length() <= 100 * 1024)
+                text += line;
+
+            textBox->setText(text);
+            textBox->focus();
+            return true;
+        }
+
+        virtual void run(tgui::Gui& gui)
+        {
+            sf::Event event;
+            event.type = sf::Event::TextEntered;
+
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                event.text.unicode = (i % 10 == 9) ? ' ' : 'a' + (i % 26);
+                gui.handleEvent(event);
+            }
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Scrolls through a list box with a million items and draws it after every step
+    class ScrollListBoxScenario : public Scenario
+    {
+    public:
+
+        ScrollListBoxScenario() : Scenario("scroll_1m_item_listbox", 10) {}
+
+        virtual bool setUp(tgui::Gui& gui)
+        {
+            tgui::ListBox::Ptr listBox(gui);
+            if (!listBox->load(THEME_CONFIG_FILE))
+                return false;
+
+            listBox->setPosition(0, 0);
+            listBox->setSize(static_cast<float>(TargetWidth), static_cast<float>(TargetHeight));
+            listBox->setItemHeight(20);
+
+            for (unsigned int i = 0; i < 1000000; ++i)
+                listBox->addItem("Item " + tgui::to_string(i));
+
+            return true;
+        }
+
+        virtual void run(tgui::Gui& gui)
+        {
+            sf::Event event;
+            event.type = sf::Event::MouseWheelMoved;
+            event.mouseWheel.x = TargetWidth / 2;
+            event.mouseWheel.y = TargetHeight / 2;
+
+            for (unsigned int i = 0; i < 50; ++i)
+            {
+                event.mouseWheel.delta = (i < 25) ? -3 : 3;
+                gui.handleEvent(event);
+                gui.draw();
+            }
+
+            glFinish();
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Draws the widgets from the FullExample
+    class DrawFullExampleScenario : public Scenario
+    {
+    public:
+
+        DrawFullExampleScenario() : Scenario("draw_full_example", 200) {}
+
+        virtual bool setUp(tgui::Gui& gui)
+        {
+            return createFullExample(gui, m_Texture);
+        }
+
+        virtual void run(tgui::Gui& gui)
+        {
+            // Wait until the graphics card finished drawing, so that the whole frame is measured
+            gui.draw();
+            glFinish();
+        }
+
+    private:
+
+        sf::Texture m_Texture;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeJson(std::ostream& stream, const std::vector<Result>& results)
+    {
+        stream << std::fixed << std::setprecision(4);
+        stream << "{\n"
+               << "  \"tgui_version\": \"" << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n"
+               << "  \"unit\": \"ms\",\n"
+               << "  \"scenarios\": [";
+
+        for (std::vector<Result>::const_iterator it = results.begin(); it != results.end(); ++it)
+        {
+            stream << ((it == results.begin()) ? "\n" : ",\n")
+                   << "    {\"name\": \"" << it->name << "\", ";
+
+            writeTimings(stream, it->samples);
+            stream << "}";
+        }
+
+        stream << "\n  ]\n}\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::string outputFile;
+    std::string filter;
+    unsigned int samples = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+            outputFile = argv[++i];
+        else if ((std::strcmp(argv[i], "--filter") == 0) && (i + 1 < argc))
+            filter = argv[++i];
+        else if ((std::strcmp(argv[i], "--samples") == 0) && (i + 1 < argc))
+            samples = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else
+        {
+            std::cerr << "Usage: tgui-bench [--output file.json] [--filter name] [--samples count]" << std::endl
+                      << "The benchmark has to be started from a folder inside the examples folder." << std::endl;
+            return 1;
+        }
+    }
+
+    // The gui is drawn on a texture, so no window is needed
+    sf::RenderTexture target;
+    if (!target.create(TargetWidth, TargetHeight))
+    {
+        std::cerr << "Failed to create the render texture." << std::endl;
+        return 1;
+    }
+
+    tgui::Gui gui(target);
+
+    // The time it takes to run a scenario should not influence what is drawn in the next sample
+    gui.setFixedTimeStep(sf::milliseconds(10));
+
+    if (!gui.setGlobalFont(FONT_FILE))
+    {
+        std::cerr << "Failed to load the font, make sure to start the benchmark from a folder inside the examples folder." << std::endl;
+        return 1;
+    }
+
+    std::vector<Scenario*> scenarios;
+    scenarios.push_back(new LoadFormScenario);
+    scenarios.push_back(new CreateButtonsScenario);
+    scenarios.push_back(new MouseSweepScenario);
+    scenarios.push_back(new TypingScenario);
+    scenarios.push_back(new ScrollListBoxScenario);
+    scenarios.push_back(new DrawFullExampleScenario);
+
+    std::vector<Result> results;
+    bool success = true;
+    for (std::vector<Scenario*>::iterator it = scenarios.begin(); it != scenarios.end(); ++it)
+    {
+        Scenario& scenario = **it;
+        if (!filter.empty() && (scenario.getName().find(filter) == std::string::npos))
+            continue;
+
+        std::cerr << "Running " << scenario.getName() << std::endl;
+        if (!scenario.setUp(gui))
+        {
+            std::cerr << "Failed to set up " << scenario.getName() << std::endl;
+            scenario.tearDown(gui);
+            success = false;
+            continue;
+        }
+
+        Result result;
+        result.name = scenario.getName();
+
+        // The first run is not measured, it fills the caches just like a real application would after startup
+        scenario.run(gui);
+
+        const unsigned int sampleCount = samples ? samples : scenario.getDefaultSamples();
+        for (unsigned int i = 0; i < sampleCount; ++i)
+        {
+            sf::Clock clock;
+            scenario.run(gui);
+            result.samples.push_back(clock.getElapsedTime().asMicroseconds() / 1000.0);
+        }
+
+        scenario.tearDown(gui);
+        results.push_back(result);
+    }
+
+    for (std::vector<Scenario*>::iterator it = scenarios.begin(); it != scenarios.end(); ++it)
+        delete *it;
+
+    if (outputFile.empty())
+        writeJson(std::cout, results);
+    else
+    {
+        std::ofstream file(outputFile.c_str());
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open " << outputFile << std::endl;
+            return 1;
+        }
+
+        writeJson(file, results);
+    }
+
+    return success ? 0 : 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Button.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,6 +50,10 @@ namespace tgui
     Button::Button(const Button& copy) :
     ClickableWidget     (copy),
     m_LoadedConfigFile  (copy.m_LoadedConfigFile),
+    m_SpriteNormal      (copy.m_SpriteNormal),
+    m_SpriteHover       (copy.m_SpriteHover),
+    m_SpriteDown        (copy.m_SpriteDown),
+    m_SpriteFocused     (copy.m_SpriteFocused),
     m_SplitImage        (copy.m_SplitImage),
     m_SeparateHoverImage(copy.m_SeparateHoverImage),
     m_Text              (copy.m_Text),
@@ -111,6 +117,10 @@ namespace tgui
             std::swap(m_TextureFocused_L,   temp.m_TextureFocused_L);
             std::swap(m_TextureFocused_M,   temp.m_TextureFocused_M);
             std::swap(m_TextureFocused_R,   temp.m_TextureFocused_R);
+            std::swap(m_SpriteNormal,       temp.m_SpriteNormal);
+            std::swap(m_SpriteHover,        temp.m_SpriteHover);
+            std::swap(m_SpriteDown,         temp.m_SpriteDown);
+            std::swap(m_SpriteFocused,      temp.m_SpriteFocused);
             std::swap(m_SplitImage,         temp.m_SplitImage);
             std::swap(m_SeparateHoverImage, temp.m_SeparateHoverImage);
             std::swap(m_Text,               temp.m_Text);
@@ -131,6 +141,10 @@ namespace tgui
 
     bool Button::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Button::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -333,6 +347,7 @@ namespace tgui
             if ((m_TextureNormal_L.data != nullptr) && (m_TextureNormal_M.data != nullptr) && (m_TextureNormal_R.data != nullptr))
             {
                 m_Loaded = true;
+                m_SpriteNormal.setTextures(m_TextureNormal_L, m_TextureNormal_M, m_TextureNormal_R);
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
             }
@@ -347,15 +362,21 @@ namespace tgui
             {
                 m_AllowFocus = true;
                 m_WidgetPhase |= WidgetPhase_Focused;
+                m_SpriteFocused.setTextures(m_TextureFocused_L, m_TextureFocused_M, m_TextureFocused_R);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
+                m_SpriteHover.setTextures(m_TextureHover_L, m_TextureHover_M, m_TextureHover_R);
             }
             if ((m_TextureDown_L.data != nullptr) && (m_TextureDown_M.data != nullptr) && (m_TextureDown_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_MouseDown;
+                m_SpriteDown.setTextures(m_TextureDown_L, m_TextureDown_M, m_TextureDown_R);
             }
+
+            // Recalculate the sprites now that all images are known
+            setSize(m_Size.x, m_Size.y);
         }
         else // The image isn't split
         {
@@ -401,35 +422,16 @@ namespace tgui
 
     void Button::setPosition(float x, float y)
     {
+        markDirty();
+
         Transformable::setPosition(x, y);
 
         if (m_SplitImage)
         {
-            m_TextureDown_L.sprite.setPosition(x, y);
-            m_TextureHover_L.sprite.setPosition(x, y);
-            m_TextureNormal_L.sprite.setPosition(x, y);
-            m_TextureFocused_L.sprite.setPosition(x, y);
-
-            // Check if the middle image may be drawn
-            if ((m_TextureNormal_M.sprite.getScale().y * (m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x)) < m_Size.x)
-            {
-                m_TextureDown_M.sprite.setPosition(x + (m_TextureDown_L.getWidth() * m_TextureDown_L.sprite.getScale().x), y);
-                m_TextureHover_M.sprite.setPosition(x + (m_TextureHover_L.getWidth() * m_TextureHover_L.sprite.getScale().x), y);
-                m_TextureNormal_M.sprite.setPosition(x + (m_TextureNormal_L.getWidth() * m_TextureNormal_L.sprite.getScale().x), y);
-                m_TextureFocused_M.sprite.setPosition(x + (m_TextureFocused_L.getWidth() * m_TextureFocused_L.sprite.getScale().x), y);
-
-                m_TextureDown_R.sprite.setPosition(m_TextureDown_M.sprite.getPosition().x + (m_TextureDown_M.getWidth() * m_TextureDown_M.sprite.getScale().x), y);
-                m_TextureHover_R.sprite.setPosition(m_TextureHover_M.sprite.getPosition().x + (m_TextureHover_M.getWidth() * m_TextureHover_M.sprite.getScale().x), y);
-                m_TextureNormal_R.sprite.setPosition(m_TextureNormal_M.sprite.getPosition().x + (m_TextureNormal_M.getWidth() * m_TextureNormal_M.sprite.getScale().x), y);
-                m_TextureFocused_R.sprite.setPosition(m_TextureFocused_M.sprite.getPosition().x + (m_TextureFocused_M.getWidth() * m_TextureFocused_M.sprite.getScale().x), y);
-            }
-            else // The middle image isn't drawn
-            {
-                m_TextureDown_R.sprite.setPosition(x + (m_TextureDown_L.getWidth() * m_TextureDown_L.sprite.getScale().x), y);
-                m_TextureHover_R.sprite.setPosition(x + (m_TextureHover_L.getWidth() * m_TextureHover_L.sprite.getScale().x), y);
-                m_TextureNormal_R.sprite.setPosition(x + (m_TextureNormal_L.getWidth() * m_TextureNormal_L.sprite.getScale().x), y);
-                m_TextureFocused_R.sprite.setPosition(x + (m_TextureFocused_L.getWidth() * m_TextureFocused_L.sprite.getScale().x), y);
-            }
+            m_SpriteDown.setPosition(x, y);
+            m_SpriteHover.setPosition(x, y);
+            m_SpriteNormal.setPosition(x, y);
+            m_SpriteFocused.setPosition(x, y);
         }
         else // The images aren't split
         {
@@ -440,14 +442,17 @@ namespace tgui
         }
 
         // Set the position of the text
-        m_Text.setPosition(std::floor(x + (m_Size.x - m_Text.getLocalBounds().width) * 0.5f -  m_Text.getLocalBounds().left),
-                           std::floor(y + (m_Size.y - m_Text.getLocalBounds().height) * 0.5f -  m_Text.getLocalBounds().top));
+        const sf::FloatRect textBounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+        m_Text.setPosition(std::floor(x + (m_Size.x - textBounds.width) * 0.5f -  textBounds.left),
+                           std::floor(y + (m_Size.y - textBounds.height) * 0.5f -  textBounds.top));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Button::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -463,38 +468,10 @@ namespace tgui
         // Drawing the button image will be different when the image is split
         if (m_SplitImage)
         {
-            float scalingY = m_Size.y / m_TextureNormal_M.getSize().y;
-
-            m_TextureDown_L.sprite.setScale(scalingY, scalingY);
-            m_TextureHover_L.sprite.setScale(scalingY, scalingY);
-            m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
-            m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
-
-            // Check if the middle image may be drawn
-            if (((scalingY) * (m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x)) < m_Size.x)
-            {
-                // Calculate the scale for our middle image
-                float scaleX = (m_Size.x / m_TextureNormal_M.getSize().x) -
-                               (((m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x) * (scalingY))
-                                / m_TextureNormal_M.getSize().x);
-
-                m_TextureDown_M.sprite.setScale(scaleX, scalingY);
-                m_TextureHover_M.sprite.setScale(scaleX, scalingY);
-                m_TextureNormal_M.sprite.setScale(scaleX, scalingY);
-                m_TextureFocused_M.sprite.setScale(scaleX, scalingY);
-            }
-            else // The middle image is not drawn
-            {
-                m_TextureDown_M.sprite.setScale(0, 0);
-                m_TextureHover_M.sprite.setScale(0, 0);
-                m_TextureNormal_M.sprite.setScale(0, 0);
-                m_TextureFocused_M.sprite.setScale(0, 0);
-            }
-
-            m_TextureDown_R.sprite.setScale(scalingY, scalingY);
-            m_TextureHover_R.sprite.setScale(scalingY, scalingY);
-            m_TextureNormal_R.sprite.setScale(scalingY, scalingY);
-            m_TextureFocused_R.sprite.setScale(scalingY, scalingY);
+            m_SpriteDown.setSize(m_Size.x, m_Size.y);
+            m_SpriteHover.setSize(m_Size.x, m_Size.y);
+            m_SpriteNormal.setSize(m_Size.x, m_Size.y);
+            m_SpriteFocused.setSize(m_Size.x, m_Size.y);
         }
         else // The image is not split
         {
@@ -512,6 +489,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        markDirty();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -526,14 +505,14 @@ namespace tgui
             // Calculate a possible text size
             float size = m_Size.y * 0.85f;
             m_Text.setCharacterSize(static_cast<unsigned int>(size));
-            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - m_Text.getLocalBounds().top));
+            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Text).top));
 
             // Make sure that the text isn't too width
-            if (m_Text.getGlobalBounds().width > (m_Size.x * 0.8f))
+            if (TGUI_TextMeasurementCache.getGlobalBounds(m_Text).width > (m_Size.x * 0.8f))
             {
                 // The text is too width, so make it smaller
-                m_Text.setCharacterSize(static_cast<unsigned int>(size * m_Size.x * 0.8f / m_Text.getGlobalBounds().width));
-                m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - m_Text.getLocalBounds().top));
+                m_Text.setCharacterSize(static_cast<unsigned int>(size * m_Size.x * 0.8f / TGUI_TextMeasurementCache.getGlobalBounds(m_Text).width));
+                m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Text).top));
             }
         }
         else // When the text has a fixed size
@@ -543,8 +522,9 @@ namespace tgui
         }
 
         // Set the position of the text
-        m_Text.setPosition(std::floor(getPosition().x + (m_Size.x - m_Text.getLocalBounds().width) * 0.5f -  m_Text.getLocalBounds().left),
-                           std::floor(getPosition().y + (m_Size.y - m_Text.getLocalBounds().height) * 0.5f -  m_Text.getLocalBounds().top));
+        const sf::FloatRect textBounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+        m_Text.setPosition(std::floor(getPosition().x + (m_Size.x - textBounds.width) * 0.5f -  textBounds.left),
+                           std::floor(getPosition().y + (m_Size.y - textBounds.height) * 0.5f -  textBounds.top));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -558,7 +538,10 @@ namespace tgui
 
     void Button::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Text.setFont(font);
+        TGUI_FontManager.trackText(m_Text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,6 +555,8 @@ namespace tgui
 
     void Button::setTextColor(const sf::Color& color)
     {
+        markDirty();
+
         m_Text.setColor(color);
     }
 
@@ -586,6 +571,8 @@ namespace tgui
 
     void Button::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Change the text size
         m_TextSize = size;
 
@@ -605,19 +592,16 @@ namespace tgui
 
     void Button::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_SplitImage)
         {
-            m_TextureNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureHover_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureDown_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureFocused_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-
-            m_TextureNormal_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureHover_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureDown_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureFocused_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteNormal.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteHover.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteDown.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteFocused.setColor(sf::Color(255, 255, 255, m_Opacity));
         }
 
         m_TextureNormal_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -657,6 +641,8 @@ namespace tgui
 
     void Button::widgetFocused()
     {
+        markDirty();
+
         // We can't be focused when we don't have a focus image
         if ((m_WidgetPhase & WidgetPhase_Focused) == 0)
             m_Parent->unfocusWidget(this);
@@ -728,60 +714,34 @@ namespace tgui
 
     void Button::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Button::draw");
+
         if (m_SplitImage)
         {
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
-                {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
-                }
+                    drawCounted(target, m_SpriteDown, states);
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
-                }
+                    drawCounted(target, m_SpriteHover, states);
                 else
-                {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
-                }
+                    drawCounted(target, m_SpriteNormal, states);
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
-                {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
-                }
+                    drawCounted(target, m_SpriteDown, states);
                 else
-                {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
-                }
+                    drawCounted(target, m_SpriteNormal, states);
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
-                }
+                    drawCounted(target, m_SpriteHover, states);
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-            {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
-            }
+                drawCounted(target, m_SpriteFocused, states);
         }
         else // The images aren't split
         {
@@ -789,44 +749,44 @@ namespace tgui
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_M, states);
+                    drawCounted(target, m_TextureDown_M, states);
                 }
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_M, states);
+                    drawCounted(target, m_TextureHover_M, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    drawCounted(target, m_TextureNormal_M, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_M, states);
+                    drawCounted(target, m_TextureDown_M, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    drawCounted(target, m_TextureNormal_M, states);
                 }
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_M, states);
+                    drawCounted(target, m_TextureHover_M, states);
                 }
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_M, states);
+                drawCounted(target, m_TextureFocused_M, states);
             }
         }
 
         // If the button has a text then also draw the text
-        target.draw(m_Text, states);
+        drawCounted(target, m_Text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,8 @@
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ChatBox.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -117,6 +119,10 @@ namespace tgui
 
     bool ChatBox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("ChatBox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -220,6 +226,8 @@ namespace tgui
 
     void ChatBox::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -251,8 +259,8 @@ namespace tgui
         float heightDiff = m_Panel->getSize().y - oldHeight;
 
         // Reposition all labels in the chatbox
-        std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
-        for (std::vector<Widget::Ptr>::iterator it = labels.begin(); it != labels.end(); ++it)
+        const std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
+        for (std::vector<Widget::Ptr>::const_iterator it = labels.begin(); it != labels.end(); ++it)
             (*it)->setPosition((*it)->getPosition().x, (*it)->getPosition().y + heightDiff);
     }
 
@@ -267,6 +275,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color)
     {
+        markDirty();
+
         // Call this function for every line in the text
         std::string::size_type newlinePos = text.find("\n");
         if (newlinePos != std::string::npos)
@@ -333,10 +343,12 @@ namespace tgui
 
     void ChatBox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Panel->setGlobalFont(font);
 
-        std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
-        for (std::vector<Widget::Ptr>::iterator it = labels.begin(); it != labels.end(); ++it)
+        const std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
+        for (std::vector<Widget::Ptr>::const_iterator it = labels.begin(); it != labels.end(); ++it)
             static_cast<Label::Ptr>(*it)->setTextFont(font);
     }
 
@@ -351,6 +363,8 @@ namespace tgui
 
     void ChatBox::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -380,6 +394,8 @@ namespace tgui
 
     void ChatBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        markDirty();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -395,8 +411,8 @@ namespace tgui
         m_Panel->setSize(width, m_Panel->getSize().y);
 
         // Reposition the labels
-        std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
-        for (std::vector<Widget::Ptr>::iterator it = labels.begin(); it != labels.end(); ++it)
+        const std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
+        for (std::vector<Widget::Ptr>::const_iterator it = labels.begin(); it != labels.end(); ++it)
             (*it)->setPosition(m_LeftBorder + 2.0f, (*it)->getPosition().y);
 
         // If there is a scrollbar then reinitialize it
@@ -411,6 +427,8 @@ namespace tgui
 
     void ChatBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_Panel->setBackgroundColor(backgroundColor);
     }
 
@@ -418,6 +436,8 @@ namespace tgui
 
     void ChatBox::setBorderColor(const sf::Color& borderColor)
     {
+        markDirty();
+
         m_BorderColor = borderColor;
     }
 
@@ -443,6 +463,8 @@ namespace tgui
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
 
+        markDirty();
+
         // If the scrollbar was already created then delete it first
         if (m_Scroll != nullptr)
             delete m_Scroll;
@@ -473,6 +495,8 @@ namespace tgui
 
     void ChatBox::removeScrollbar()
     {
+        markDirty();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -482,6 +506,8 @@ namespace tgui
 
     void ChatBox::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
         m_BorderColor.a = m_Opacity;
@@ -535,6 +561,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the mouse down flag to true
         m_MouseDown = true;
 
@@ -564,6 +592,8 @@ namespace tgui
 
     void ChatBox::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         // If there is a scrollbar then pass it the event
         if (m_Scroll != nullptr)
         {
@@ -627,15 +657,16 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            // The chat box only has to be drawn again when the scrollbar changes
+            const unsigned int oldValue = m_Scroll->getValue();
+            const bool oldMouseHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + m_Panel->getSize().x - m_RightBorder - m_Scroll->getSize().x, getPosition().y + m_TopBorder);
 
             // Check if you are dragging the thumb of the scrollbar
             if ((m_Scroll->m_MouseDown) && (m_Scroll->m_MouseDownOnThumb))
             {
-                // Remember the old scrollbar value
-                unsigned int oldValue = m_Scroll->getValue();
-
                 // Pass the event, even when the mouse is not on top of the scrollbar
                 m_Scroll->mouseMoved(x, y);
 
@@ -652,6 +683,9 @@ namespace tgui
 
             // Reset the position
             m_Scroll->setPosition(0, 0);
+
+            if ((oldValue != m_Scroll->getValue()) || (oldMouseHover != m_Scroll->m_MouseHover))
+                markDirty();
         }
     }
 
@@ -687,6 +721,8 @@ namespace tgui
         {
             if (m_Scroll->getLowValue() < m_Scroll->getMaximum())
             {
+                markDirty();
+
                 // Check if you are scrolling down
                 if (delta < 0)
                 {
@@ -783,8 +819,10 @@ namespace tgui
 
     void ChatBox::updateDisplayedText()
     {
+        TGUI_PROFILE_ZONE("ChatBox::updateDisplayedText");
+
         float bottomPosition = m_Panel->getSize().y;
-        std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
+        const std::vector<Widget::Ptr>& labels = m_Panel->getWidgets();
         for (unsigned int i = labels.size(); i > 0; --i)
         {
             unsigned int index = i - 1;
@@ -804,6 +842,8 @@ namespace tgui
 
     void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("ChatBox::draw");
+
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -813,21 +853,21 @@ namespace tgui
         // Draw left border
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Panel->getSize().y));
         border.setFillColor(m_BorderColor);
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_Panel->getSize().x, static_cast<float>(m_TopBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw right border
         border.setPosition(m_Panel->getSize().x - m_RightBorder, 0);
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Panel->getSize().y));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw bottom border
         border.setPosition(0, m_Panel->getSize().y - m_BottomBorder);
         border.setSize(sf::Vector2f(m_Panel->getSize().x, static_cast<float>(m_BottomBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -27,6 +27,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Checkbox.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,6 +106,10 @@ namespace tgui
 
     bool Checkbox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Checkbox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -225,6 +231,8 @@ namespace tgui
 
     void Checkbox::setPosition(float x, float y)
     {
+        markDirty();
+
         Transformable::setPosition(x, y);
 
         m_TextureUnchecked.sprite.setPosition(x, y);
@@ -232,7 +240,7 @@ namespace tgui
         m_TextureFocused.sprite.setPosition(x, y);
         m_TextureHover.sprite.setPosition(x, y);
 
-        sf::FloatRect textBounds = m_Text.getLocalBounds();
+        sf::FloatRect textBounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
         m_Text.setPosition(x + std::floor(m_Size.x * 11.0f / 10.0f - textBounds.left),
                            y + std::floor(((m_Size.y - textBounds.height) / 2.0f) - textBounds.top));
     }
@@ -242,6 +250,8 @@ namespace tgui
 
     void Checkbox::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the checkbox wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -275,13 +285,18 @@ namespace tgui
         if (m_Text.getString().isEmpty())
             return m_Size;
         else
-            return sf::Vector2f(static_cast<float>((m_Size.x * 11.0 / 10.0) + m_Text.getLocalBounds().left + m_Text.getLocalBounds().width), m_Size.y);
+        {
+            const sf::FloatRect textBounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+            return sf::Vector2f(static_cast<float>((m_Size.x * 11.0 / 10.0) + textBounds.left + textBounds.width), m_Size.y);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Checkbox::check()
     {
+        markDirty();
+
         if (m_Checked == false)
         {
             m_Checked = true;
@@ -300,6 +315,8 @@ namespace tgui
 
     void Checkbox::uncheck()
     {
+        markDirty();
+
         if (m_Checked)
         {
             m_Checked = false;
@@ -325,6 +342,8 @@ namespace tgui
 
     void Checkbox::setText(const sf::String& text)
     {
+        markDirty();
+
         // Don't do anything when the checkbox wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -337,7 +356,7 @@ namespace tgui
         {
             // Set the text size
             m_Text.setCharacterSize(static_cast<unsigned int>(m_Size.y));
-            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - m_Text.getLocalBounds().top));
+            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Text).top));
         }
         else // When the text has a fixed size
         {
@@ -360,7 +379,10 @@ namespace tgui
 
     void Checkbox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Text.setFont(font);
+        TGUI_FontManager.trackText(m_Text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,6 +396,8 @@ namespace tgui
 
     void Checkbox::setTextColor(const sf::Color& Color)
     {
+        markDirty();
+
         m_Text.setColor(Color);
     }
 
@@ -388,6 +412,8 @@ namespace tgui
 
     void Checkbox::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Change the text size
         m_TextSize = size;
 
@@ -406,6 +432,8 @@ namespace tgui
 
     void Checkbox::allowTextClick(bool acceptTextClick)
     {
+        markDirty();
+
         m_AllowTextClick = acceptTextClick;
     }
 
@@ -413,6 +441,8 @@ namespace tgui
 
     void Checkbox::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureChecked.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -439,7 +469,7 @@ namespace tgui
             // Check if the mouse is on top of the text
             if (m_AllowTextClick)
             {
-                sf::FloatRect bounds = m_Text.getLocalBounds();
+                sf::FloatRect bounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
                 if (sf::FloatRect(bounds.left, bounds.top, bounds.width, bounds.height).contains(x - (getPosition().x + ((m_Size.x * 11.0f / 10.0f))), y - getPosition().y - ((m_Size.y - bounds.height) / 2.0f) + bounds.top))
                     return true;
             }
@@ -457,6 +487,8 @@ namespace tgui
 
     void Checkbox::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         // Add the callback (if the user requested it)
         if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
         {
@@ -533,6 +565,8 @@ namespace tgui
 
     void Checkbox::widgetFocused()
     {
+        markDirty();
+
         // We can't be focused when we don't have a focus image
         if ((m_WidgetPhase & WidgetPhase_Focused) == 0)
             m_Parent->unfocusWidget(this);
@@ -626,21 +660,23 @@ namespace tgui
 
     void Checkbox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Checkbox::draw");
+
         if (m_Checked)
-            target.draw(m_TextureChecked, states);
+            drawCounted(target, m_TextureChecked, states);
         else
-            target.draw(m_TextureUnchecked, states);
+            drawCounted(target, m_TextureUnchecked, states);
 
         // When the checkbox is focused then draw an extra image
         if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-            target.draw(m_TextureFocused, states);
+            drawCounted(target, m_TextureFocused, states);
 
         // When the mouse is on top of the checkbox then draw an extra image
         if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-            target.draw(m_TextureHover, states);
+            drawCounted(target, m_TextureHover, states);
 
         // Draw the text
-        target.draw(m_Text, states);
+        drawCounted(target, m_Text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,8 +27,8 @@
 
 #include <TGUI/Button.hpp>
 #include <TGUI/ChildWindow.hpp>
-
-/// \todo Add SplitImage to title bar
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -67,6 +67,7 @@ namespace tgui
     m_DistanceToSide   (childWindowToCopy.m_DistanceToSide),
     m_TitleAlignment   (childWindowToCopy.m_TitleAlignment),
     m_BorderColor      (childWindowToCopy.m_BorderColor),
+    m_SpriteTitleBar   (childWindowToCopy.m_SpriteTitleBar),
     m_KeepInParent     (childWindowToCopy.m_KeepInParent)
     {
         // Copy the textures
@@ -83,7 +84,6 @@ namespace tgui
         {
             m_BackgroundSprite.setTexture(*m_BackgroundTexture, true);
             m_BackgroundSprite.setScale(m_Size.x / m_BackgroundTexture->getSize().x, m_Size.y / m_BackgroundTexture->getSize().y);
-            m_BackgroundSprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         }
     }
 
@@ -133,6 +133,7 @@ namespace tgui
             std::swap(m_BorderColor,       temp.m_BorderColor);
             std::swap(m_TextureTitleBar_L, temp.m_TextureTitleBar_L);
             std::swap(m_TextureTitleBar_M, temp.m_TextureTitleBar_M);
+            std::swap(m_SpriteTitleBar,    temp.m_SpriteTitleBar);
             std::swap(m_TextureTitleBar_R, temp.m_TextureTitleBar_R);
             std::swap(m_CloseButton,       temp.m_CloseButton);
             std::swap(m_KeepInParent,      temp.m_KeepInParent);
@@ -152,6 +153,10 @@ namespace tgui
 
     bool ChildWindow::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("ChildWindow::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // Until the loading succeeds, the child window will be marked as unloaded
@@ -216,6 +221,34 @@ namespace tgui
                     TGUI_OUTPUT("TGUI error: Failed to parse value for TitlebarImage in section ChildWindow in " + configFileFilename + ".");
                     return false;
                 }
+
+                m_SplitImage = false;
+            }
+            else if (property == "titlebarimage_l")
+            {
+                if (!configFile.readTexture(value, configFileFolder, m_TextureTitleBar_L))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to parse value for TitlebarImage_L in section ChildWindow in " + configFileFilename + ".");
+                    return false;
+                }
+            }
+            else if (property == "titlebarimage_m")
+            {
+                if (!configFile.readTexture(value, configFileFolder, m_TextureTitleBar_M))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to parse value for TitlebarImage_M in section ChildWindow in " + configFileFilename + ".");
+                    return false;
+                }
+
+                m_SplitImage = true;
+            }
+            else if (property == "titlebarimage_r")
+            {
+                if (!configFile.readTexture(value, configFileFolder, m_TextureTitleBar_R))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to parse value for TitlebarImage_R in section ChildWindow in " + configFileFilename + ".");
+                    return false;
+                }
             }
             else if (property == "closebuttonseparatehoverimage")
             {
@@ -282,7 +315,20 @@ namespace tgui
         }
 
         // Make sure the required texture was loaded
-        if ((m_TextureTitleBar_M.data != nullptr))
+        if (m_SplitImage)
+        {
+            if ((m_TextureTitleBar_L.data != nullptr) && (m_TextureTitleBar_M.data != nullptr) && (m_TextureTitleBar_R.data != nullptr))
+            {
+                m_TitleBarHeight = m_TextureTitleBar_M.getSize().y;
+                m_SpriteTitleBar.setTextures(m_TextureTitleBar_L, m_TextureTitleBar_M, m_TextureTitleBar_R);
+            }
+            else
+            {
+                TGUI_OUTPUT("TGUI error: Not all needed images were loaded for the child window. Is the ChildWindow section in " + configFileFilename + " complete?");
+                return false;
+            }
+        }
+        else if (m_TextureTitleBar_M.data != nullptr)
         {
             m_TitleBarHeight = m_TextureTitleBar_M.getSize().y;
         }
@@ -310,6 +356,8 @@ namespace tgui
 
     void ChildWindow::setSize(float width, float height)
     {
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -332,8 +380,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Vector2f ChildWindow::getFullSize() const
+    {
+        return sf::Vector2f(m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TitleBarHeight + m_TopBorder + m_BottomBorder);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect ChildWindow::getOpaqueArea() const
+    {
+        if ((m_Loaded == false) || (m_Opacity < 255) || (m_BackgroundColor.a < 255))
+            return sf::FloatRect();
+
+        if (m_BorderColor.a == 255)
+            return sf::FloatRect(0, static_cast<float>(m_TitleBarHeight), m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder);
+        else
+            return sf::FloatRect(static_cast<float>(m_LeftBorder), static_cast<float>(m_TitleBarHeight + m_TopBorder), m_Size.x, m_Size.y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f ChildWindow::getWidgetsOffset() const
+    {
+        return sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_TitleBarHeight + m_TopBorder));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::setBackgroundTexture(sf::Texture *const texture)
     {
+        markDirty();
+
         // Store the texture
         m_BackgroundTexture = texture;
 
@@ -356,6 +433,8 @@ namespace tgui
 
     void ChildWindow::setTitleBarHeight(unsigned int height)
     {
+        markDirty();
+
         // Don't continue when the child window has not been loaded yet
         if (m_Loaded == false)
             return;
@@ -369,6 +448,7 @@ namespace tgui
 
         // Set the size of the text in the title bar
         m_TitleText.setCharacterSize(m_TitleBarHeight * 8 / 10);
+        TGUI_FontManager.trackText(m_TitleText);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,6 +462,8 @@ namespace tgui
 
     void ChildWindow::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -394,31 +476,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::setTransparency(unsigned char transparency)
-    {
-        Container::setTransparency(transparency);
-
-        m_BackgroundSprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-
-        m_IconTexture.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-
-        m_TextureTitleBar_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureTitleBar_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureTitleBar_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-
-        m_CloseButton->setTransparency(m_Opacity);
-
-        m_TitleText.setColor(sf::Color(m_TitleText.getColor().r, m_TitleText.getColor().g, m_TitleText.getColor().b, m_Opacity));
-
-        m_BackgroundColor.a = m_Opacity;
-        m_BorderColor.a = m_Opacity;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     void ChildWindow::setTitle(const sf::String& title)
     {
+        markDirty();
+
         m_TitleText.setString(title);
+        TGUI_FontManager.trackText(m_TitleText);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -432,6 +495,8 @@ namespace tgui
 
     void ChildWindow::setTitleColor(const sf::Color& color)
     {
+        markDirty();
+
         m_TitleText.setColor(color);
     }
 
@@ -446,6 +511,8 @@ namespace tgui
 
     void ChildWindow::setBorderColor(const sf::Color& borderColor)
     {
+        markDirty();
+
         m_BorderColor = borderColor;
     }
 
@@ -460,6 +527,8 @@ namespace tgui
 
     void ChildWindow::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        markDirty();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -471,6 +540,8 @@ namespace tgui
 
     void ChildWindow::setDistanceToSide(unsigned int distanceToSide)
     {
+        markDirty();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -485,6 +556,8 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        markDirty();
+
         m_TitleAlignment = alignment;
     }
 
@@ -499,6 +572,8 @@ namespace tgui
 
     void ChildWindow::setIcon(const std::string& filename)
     {
+        markDirty();
+
         // If a texture has already been loaded then remove it first
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
@@ -517,6 +592,8 @@ namespace tgui
 
     void ChildWindow::removeIcon()
     {
+        markDirty();
+
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
     }
@@ -532,6 +609,8 @@ namespace tgui
 
     void ChildWindow::keepInParent(bool enabled)
     {
+        markDirty();
+
         m_KeepInParent = enabled;
     }
 
@@ -546,6 +625,8 @@ namespace tgui
 
     void ChildWindow::setPosition(float x, float y)
     {
+        markDirty();
+
         if (m_KeepInParent)
         {
             if (y < 0)
@@ -626,7 +707,10 @@ namespace tgui
 
             // Send the mouse press event to the close button
             if (m_CloseButton->mouseOnWidget(x, y))
+            {
                 m_CloseButton->leftMousePressed(x, y);
+                markDirty();
+            }
             else
             {
                 // The mouse went down on the title bar
@@ -645,7 +729,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                markDirty();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -678,6 +765,7 @@ namespace tgui
             if (m_CloseButton->m_MouseDown == true)
             {
                 m_CloseButton->m_MouseDown = false;
+                markDirty();
 
                 // Check if the mouse is still on the close button
                 if (m_CloseButton->mouseOnWidget(x, y))
@@ -707,11 +795,18 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                markDirty();
+            }
 
             // Change the mouse down flag
             m_MouseDown = false;
-            m_CloseButton->mouseNoLongerDown();
+            if (m_CloseButton->m_MouseDown)
+            {
+                m_CloseButton->mouseNoLongerDown();
+                markDirty();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -760,8 +855,11 @@ namespace tgui
             m_CloseButton->setPosition(position.x + ((m_Size.x + m_LeftBorder + m_RightBorder - m_DistanceToSide - m_CloseButton->getSize().x)), position.y + ((m_TitleBarHeight / 2.f) - (m_CloseButton->getSize().x / 2.f)));
 
             // Send the hover event to the close button
-            if (m_CloseButton->mouseOnWidget(x, y))
+            if (m_CloseButton->mouseOnWidget(x, y) && (m_CloseButton->m_MouseHover == false))
+            {
                 m_CloseButton->mouseMoved(x, y);
+                markDirty();
+            }
 
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
@@ -771,7 +869,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                markDirty();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -904,19 +1005,28 @@ namespace tgui
 
     void ChildWindow::initialize(Container *const parent)
     {
-        m_Parent = parent;
-        setGlobalFont(m_Parent->getGlobalFont());
+        Container::initialize(parent);
         m_TitleText.setFont(m_Parent->getGlobalFont());
+        TGUI_FontManager.trackText(m_TitleText);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChildWindow::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("ChildWindow::draw");
+
         // Don't draw when the child window wasn't created
         if (m_Loaded == false)
             return;
 
+        // Draw the cached texture instead when caching is enabled
+        if (drawCache(target, states, getFullSize()))
+            return;
+
+        // Draw everything with the transparency of the child window
+        float oldOpacity = applyOpacity(target, states);
+
         // Get the current position
         sf::Vector2f position = getPosition();
 
@@ -951,8 +1061,9 @@ namespace tgui
         // Check if the title bar image is split
         if (m_SplitImage)
         {
-            // Split image is not supported yet
-            return;
+            // Draw the title bar
+            m_SpriteTitleBar.setSize(m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight));
+            drawCounted(target, m_SpriteTitleBar, states);
         }
         else // The title bar image isn't split
         {
@@ -960,7 +1071,7 @@ namespace tgui
             states.transform.scale((m_Size.x + m_LeftBorder + m_RightBorder) / m_TextureTitleBar_M.getSize().x, static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y);
 
             // Draw the title bar
-            target.draw(m_TextureTitleBar_M, states);
+            drawCounted(target, m_TextureTitleBar_M, states);
 
             // Undo the scaling
             states.transform.scale(static_cast<float>(m_TextureTitleBar_M.getSize().x) / (m_Size.x + m_LeftBorder + m_RightBorder), static_cast<float>(m_TextureTitleBar_M.getSize().y) / m_TitleBarHeight);
@@ -970,7 +1081,7 @@ namespace tgui
         if (m_IconTexture.data)
         {
             states.transform.translate(static_cast<float>(m_DistanceToSide), (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / 2.f);
-            target.draw(m_IconTexture, states);
+            drawCounted(target, m_IconTexture, states);
             states.transform.translate(m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x, (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / -2.f);
         }
 
@@ -994,35 +1105,35 @@ namespace tgui
                 scissorTop = scissorBottom;
 
             // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
             // Draw the text, depending on the alignment
             if (m_TitleAlignment == TitleAlignmentLeft)
             {
                 states.transform.translate(static_cast<float>(m_DistanceToSide), 0);
-                target.draw(m_TitleText, states);
+                drawCounted(target, m_TitleText, states);
             }
             else if (m_TitleAlignment == TitleAlignmentCentered)
             {
                 if (m_IconTexture.data)
-                    states.transform.translate(m_DistanceToSide + (((m_Size.x + m_LeftBorder + m_RightBorder) - 4*m_DistanceToSide - (m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x) - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width) / 2.0f), 0);
+                    states.transform.translate(m_DistanceToSide + (((m_Size.x + m_LeftBorder + m_RightBorder) - 4*m_DistanceToSide - (m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x) - m_CloseButton->getSize().x - TGUI_TextMeasurementCache.getGlobalBounds(m_TitleText).width) / 2.0f), 0);
                 else
-                    states.transform.translate(m_DistanceToSide + (((m_Size.x + m_LeftBorder + m_RightBorder) - 3*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width) / 2.0f), 0);
+                    states.transform.translate(m_DistanceToSide + (((m_Size.x + m_LeftBorder + m_RightBorder) - 3*m_DistanceToSide - m_CloseButton->getSize().x - TGUI_TextMeasurementCache.getGlobalBounds(m_TitleText).width) / 2.0f), 0);
 
-                target.draw(m_TitleText, states);
+                drawCounted(target, m_TitleText, states);
             }
             else // if (m_TitleAlignment == TitleAlignmentRight)
             {
                 if (m_IconTexture.data)
-                    states.transform.translate((m_Size.x + m_LeftBorder + m_RightBorder) - (m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x) - 3*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width, 0);
+                    states.transform.translate((m_Size.x + m_LeftBorder + m_RightBorder) - (m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x) - 3*m_DistanceToSide - m_CloseButton->getSize().x - TGUI_TextMeasurementCache.getGlobalBounds(m_TitleText).width, 0);
                 else
-                    states.transform.translate((m_Size.x + m_LeftBorder + m_RightBorder) - 2*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width, 0);
+                    states.transform.translate((m_Size.x + m_LeftBorder + m_RightBorder) - 2*m_DistanceToSide - m_CloseButton->getSize().x - TGUI_TextMeasurementCache.getGlobalBounds(m_TitleText).width, 0);
 
-                target.draw(m_TitleText, states);
+                drawCounted(target, m_TitleText, states);
             }
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
         }
 
         // Move the close button to the correct position
@@ -1038,21 +1149,21 @@ namespace tgui
         // Draw left border
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Size.y + m_TopBorder + m_BottomBorder));
         border.setFillColor(m_BorderColor);
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TopBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw right border
         border.setPosition(m_Size.x + m_LeftBorder, 0);
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Size.y + m_TopBorder + m_BottomBorder));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw bottom border
         border.setPosition(0, m_Size.y + m_TopBorder);
         border.setSize(sf::Vector2f(m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_BottomBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Make room for the borders
         states.transform.translate(static_cast<float>(m_LeftBorder), static_cast<float>(m_TopBorder));
@@ -1062,12 +1173,12 @@ namespace tgui
         {
             sf::RectangleShape background(sf::Vector2f(m_Size.x, m_Size.y));
             background.setFillColor(m_BackgroundColor);
-            target.draw(background, states);
+            drawCounted(target, background, states);
         }
 
         // Draw the background image if there is one
         if (m_BackgroundTexture != nullptr)
-            target.draw(m_BackgroundSprite, states);
+            drawCounted(target, m_BackgroundSprite, states);
 
         // Calculate the clipping area
         GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.x * scaleViewX), scissor[0]);
@@ -1082,13 +1193,15 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Draw the widgets in the child window
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+
+        restoreOpacity(oldOpacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/ClickableWidget.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -78,6 +79,8 @@ namespace tgui
 
     void ClickableWidget::setSize(float width, float height)
     {
+        markDirty();
+
         m_Size.x = width;
         m_Size.y = height;
     }
@@ -110,6 +113,8 @@ namespace tgui
 
     void ClickableWidget::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         // Set the mouse down flag
         m_MouseDown = true;
 
@@ -127,6 +132,8 @@ namespace tgui
 
     void ClickableWidget::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         // Add the callback (if the user requested it)
         if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
         {
@@ -156,6 +163,8 @@ namespace tgui
 
     void ClickableWidget::draw(sf::RenderTarget&, sf::RenderStates) const
     {
+        TGUI_PROFILE_ZONE("ClickableWidget::draw");
+
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,8 @@
 #include <TGUI/ChildWindow.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ComboBox.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -120,6 +122,10 @@ namespace tgui
 
     bool ComboBox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("ComboBox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -270,6 +276,8 @@ namespace tgui
 
     void ComboBox::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't set the scale when loading failed
         if (m_Loaded == false)
             return;
@@ -305,6 +313,8 @@ namespace tgui
 
     void ComboBox::setItemsToDisplay(unsigned int nrOfItemsInList)
     {
+        markDirty();
+
         m_NrOfItemsToDisplay = nrOfItemsInList;
 
         if (m_NrOfItemsToDisplay < m_ListBox->m_Items.size())
@@ -324,6 +334,8 @@ namespace tgui
                                 const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor,
                                 const sf::Color& borderColor)
     {
+        markDirty();
+
         m_ListBox->changeColors(backgroundColor, textColor, selectedBackgroundColor, selectedTextColor, borderColor);
     }
 
@@ -331,6 +343,8 @@ namespace tgui
 
     void ComboBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_ListBox->setBackgroundColor(backgroundColor);
     }
 
@@ -338,6 +352,8 @@ namespace tgui
 
     void ComboBox::setTextColor(const sf::Color& textColor)
     {
+        markDirty();
+
         m_ListBox->setTextColor(textColor);
     }
 
@@ -345,6 +361,8 @@ namespace tgui
 
     void ComboBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        markDirty();
+
         m_ListBox->setSelectedBackgroundColor(selectedBackgroundColor);
     }
 
@@ -352,6 +370,8 @@ namespace tgui
 
     void ComboBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        markDirty();
+
         m_ListBox->setSelectedTextColor(selectedTextColor);
     }
 
@@ -359,6 +379,8 @@ namespace tgui
 
     void ComboBox::setBorderColor(const sf::Color& borderColor)
     {
+        markDirty();
+
         m_ListBox->setBorderColor(borderColor);
     }
 
@@ -401,6 +423,8 @@ namespace tgui
 
     void ComboBox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_ListBox->setTextFont(font);
     }
 
@@ -413,8 +437,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int ComboBox::getTextSize() const
+    {
+        return m_ListBox->getTextSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        markDirty();
+
         // Calculate the new item height
         unsigned int itemHeight = m_ListBox->getItemHeight() + m_TopBorder + m_BottomBorder - topBorder - bottomBorder;
 
@@ -441,6 +474,8 @@ namespace tgui
 
     int ComboBox::addItem(const sf::String& item)
     {
+        markDirty();
+
         // An item can only be added when the combo box was loaded correctly
         if (m_Loaded == false)
             return false;
@@ -457,20 +492,35 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
-        return m_ListBox->setSelectedItem(itemName);
+        const int oldSelectedItem = m_ListBox->getSelectedItemIndex();
+        const bool itemSelected = m_ListBox->setSelectedItem(itemName);
+
+        if (m_ListBox->getSelectedItemIndex() != oldSelectedItem)
+            markDirty();
+
+        return itemSelected;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::setSelectedItem(unsigned int index)
     {
-        return m_ListBox->setSelectedItem(index);
+        const int oldSelectedItem = m_ListBox->getSelectedItemIndex();
+        const bool itemSelected = m_ListBox->setSelectedItem(index);
+
+        if (m_ListBox->getSelectedItemIndex() != oldSelectedItem)
+            markDirty();
+
+        return itemSelected;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ComboBox::deselectItem()
     {
+        if (m_ListBox->getSelectedItemIndex() != -1)
+            markDirty();
+
         m_ListBox->deselectItem();
     }
 
@@ -478,20 +528,30 @@ namespace tgui
 
     bool ComboBox::removeItem(unsigned int index)
     {
-        return m_ListBox->removeItem(index);
+        if (!m_ListBox->removeItem(index))
+            return false;
+
+        markDirty();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
-        return m_ListBox->removeItem(itemName);
+        if (!m_ListBox->removeItem(itemName))
+            return false;
+
+        markDirty();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ComboBox::removeAllItems()
     {
+        markDirty();
+
         m_ListBox->removeAllItems();
     }
 
@@ -534,6 +594,8 @@ namespace tgui
 
     bool ComboBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        markDirty();
+
         return m_ListBox->setScrollbar(scrollbarConfigFileFilename);
     }
 
@@ -541,6 +603,8 @@ namespace tgui
 
     void ComboBox::removeScrollbar()
     {
+        markDirty();
+
         m_ListBox->removeScrollbar();
     }
 
@@ -548,6 +612,8 @@ namespace tgui
 
     void ComboBox::setMaximumItems(unsigned int maximumItems)
     {
+        markDirty();
+
         m_ListBox->setMaximumItems(maximumItems);
     }
 
@@ -562,6 +628,8 @@ namespace tgui
 
     void ComboBox::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
         m_ListBox->setTransparency(m_Opacity);
@@ -602,6 +670,8 @@ namespace tgui
 
     void ComboBox::leftMousePressed(float, float)
     {
+        markDirty();
+
         m_MouseDown = true;
 
         // If the list wasn't visible then open it
@@ -631,6 +701,9 @@ namespace tgui
 
     void ComboBox::leftMouseReleased(float, float)
     {
+        if (m_MouseDown)
+            markDirty();
+
         m_MouseDown = false;
     }
 
@@ -641,6 +714,8 @@ namespace tgui
         // The list isn't visible
         if (!m_ListBox->isVisible())
         {
+            markDirty();
+
             // Check if you are scrolling down
             if (delta < 0)
             {
@@ -764,6 +839,8 @@ namespace tgui
 
     void ComboBox::showListBox()
     {
+        markDirty();
+
         if (!m_ListBox->isVisible())
         {
             m_ListBox->show();
@@ -795,6 +872,8 @@ namespace tgui
 
     void ComboBox::hideListBox()
     {
+        markDirty();
+
         // If the list was open then close it now
         if (m_ListBox->isVisible())
         {
@@ -837,6 +916,8 @@ namespace tgui
 
     void ComboBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("ComboBox::draw");
+
         // Don't draw anything when the combo box was not loaded correctly
         if (m_Loaded == false)
             return;
@@ -861,21 +942,21 @@ namespace tgui
         // Draw left border
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight() + m_TopBorder + m_BottomBorder)));
         border.setFillColor(m_ListBox->m_BorderColor);
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_ListBox->getSize().x, static_cast<float>(m_TopBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw right border
         border.setPosition(m_ListBox->getSize().x - m_RightBorder, 0);
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_ListBox->getItemHeight() + m_TopBorder + m_BottomBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Draw bottom border
         border.setPosition(0, static_cast<float>(m_ListBox->getItemHeight() + m_TopBorder));
         border.setSize(sf::Vector2f(m_ListBox->getSize().x, static_cast<float>(m_BottomBorder)));
-        target.draw(border, states);
+        drawCounted(target, border, states);
 
         // Move the front rect a little bit
         states.transform.translate(static_cast<float>(m_LeftBorder), static_cast<float>(m_TopBorder));
@@ -884,12 +965,12 @@ namespace tgui
         sf::RectangleShape Front(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x - m_LeftBorder - m_RightBorder),
                                           static_cast<float>(m_ListBox->getItemHeight())));
         Front.setFillColor(m_ListBox->getBackgroundColor());
-        target.draw(Front, states);
+        drawCounted(target, Front, states);
 
         // Create a text widget to draw it
         sf::Text tempText("kg", *m_ListBox->getTextFont());
         tempText.setCharacterSize(m_ListBox->getItemHeight());
-        tempText.setCharacterSize(static_cast<unsigned int>(tempText.getCharacterSize() - tempText.getLocalBounds().top));
+        tempText.setCharacterSize(static_cast<unsigned int>(tempText.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(tempText).top));
         tempText.setColor(m_ListBox->getTextColor());
 
         // Get the old clipping area
@@ -909,15 +990,17 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Draw the selected item
-        states.transform.translate(2, std::floor((static_cast<int>(m_ListBox->getItemHeight()) - tempText.getLocalBounds().height) / 2.0f -  tempText.getLocalBounds().top));
+        const sf::FloatRect textBounds = TGUI_TextMeasurementCache.getLocalBounds(tempText);
+        states.transform.translate(2, std::floor((static_cast<int>(m_ListBox->getItemHeight()) - textBounds.height) / 2.0f -  textBounds.top));
         tempText.setString(m_ListBox->getSelectedItem());
-        target.draw(tempText, states);
+        TGUI_FontManager.trackText(tempText);
+        drawCounted(target, tempText, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
 
         // Reset the transformations
         states.transform = oldTransform;
@@ -933,16 +1016,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    drawCounted(target, m_TextureArrowUpHover, states);
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
             }
             else // There is no separate hover image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                drawCounted(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    drawCounted(target, m_TextureArrowUpHover, states);
             }
         }
         else
@@ -955,16 +1038,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowDownHover, states);
+                    drawCounted(target, m_TextureArrowDownHover, states);
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    drawCounted(target, m_TextureArrowDownNormal, states);
             }
             else // There is no separate hover image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                drawCounted(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowDownHover, states);
+                    drawCounted(target, m_TextureArrowDownHover, states);
             }
         }
     }
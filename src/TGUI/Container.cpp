@@ -26,8 +26,50 @@
 #include <stack>
 #include <cmath>
 #include <cassert>
+#include <algorithm>
+
+#include <SFML/OpenGL.hpp>
 
 #include <TGUI/TGUI.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The font that is returned by getGlobalFont when no font was set yet
+    const sf::Font& getEmptyFont()
+    {
+        static const sf::Font emptyFont;
+        return emptyFont;
+    }
+
+    // Vertex shader that multiplies the alpha of everything that is drawn inside a transparent container
+    const char opacityShaderSource[] =
+        "uniform float opacity;"
+        "void main()"
+        "{"
+        "    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;"
+        "    gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;"
+        "    gl_FrontColor = vec4(gl_Color.rgb, gl_Color.a * opacity);"
+        "}";
+
+    // Returns the shared opacity shader, or a nullptr when shaders aren't supported
+    sf::Shader* getOpacityShader()
+    {
+        static sf::Shader shader;
+        static bool loaded = sf::Shader::isAvailable() && shader.loadFromMemory(opacityShaderSource, sf::Shader::Vertex);
+
+        if (loaded)
+            return &shader;
+        else
+            return nullptr;
+    }
+
+    // The opacity that is currently set in the shader
+    float currentOpacity = 1;
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,10 +77,16 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Container::Container()
+    Container::Container() :
+    m_GlobalFont      (nullptr),
+    m_RadioButtonGroup(RadioButtonGroup::create()),
+    m_CachingEnabled  (false),
+    m_CacheTexture    (nullptr),
+    m_CacheValid      (false),
+    m_CacheRedrawn    (false),
+    m_CulledWidgetCount(0)
     {
         m_ContainerWidget = true;
-        m_AnimatedWidget = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,16 +94,38 @@ namespace tgui
     Container::Container(const Container& containerToCopy) :
         Widget                   (containerToCopy),
         m_GlobalFont             (containerToCopy.m_GlobalFont),
+        m_OldGlobalFonts         (containerToCopy.m_OldGlobalFonts),
         m_ContainerFocused       (false),
-        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions)
+        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions),
+        m_RadioButtonGroup       (RadioButtonGroup::create()),
+        m_CachingEnabled         (containerToCopy.m_CachingEnabled),
+        m_CacheTexture           (nullptr),
+        m_CacheValid             (false),
+        m_CacheRedrawn           (false),
+        m_CulledWidgetCount      (0)
     {
+        // The copy shares the fonts, the copied widgets may still use the old ones
+        TGUI_FontManager.addUser(m_GlobalFont);
+        for (std::vector<FontData*>::iterator it = m_OldGlobalFonts.begin(); it != m_OldGlobalFonts.end(); ++it)
+            TGUI_FontManager.addUser(*it);
+
         // Copy all the widgets
-        for (unsigned int i = 0; i < containerToCopy.m_EventManager.m_Widgets.size(); ++i)
+        const EventManager& eventManager = containerToCopy.m_EventManager;
+        for (unsigned int i = eventManager.m_Bottom; i != EventManager::NoEntry; i = eventManager.m_Entries[i].above)
         {
-            m_EventManager.m_Widgets.push_back(containerToCopy.m_EventManager.m_Widgets[i].clone());
-            m_ObjName.push_back(containerToCopy.m_ObjName[i]);
+            Widget::Ptr widget = eventManager.m_Entries[i].widget.clone();
+            m_EventManager.addWidget(widget, eventManager.getName(eventManager.m_Entries[i].nameId));
+            m_EventManager.m_Entries.back().font = eventManager.m_Entries[i].font;
 
-            m_EventManager.m_Widgets.back()->m_Parent = this;
+            // The copied widget continues where the original was
+            if (eventManager.m_Entries[i].timerId)
+                m_EventManager.scheduleUpdate(widget.get(), eventManager.m_Entries[i].scheduleTime, eventManager.m_Entries[i].wakeUpTime);
+
+            widget->m_Parent = this;
+
+            // The copied radio buttons have to use the group of this container
+            if (widget->m_Callback.widgetType == Type_RadioButton)
+                static_cast<RadioButton*>(widget.get())->joinParentGroup();
         }
     }
 
@@ -64,6 +134,12 @@ namespace tgui
     Container::~Container()
     {
         removeAllWidgets();
+
+        delete m_CacheTexture;
+
+        TGUI_FontManager.removeFont(m_GlobalFont);
+        for (std::vector<FontData*>::iterator it = m_OldGlobalFonts.begin(); it != m_OldGlobalFonts.end(); ++it)
+            TGUI_FontManager.removeFont(*it);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,21 +151,45 @@ namespace tgui
         {
             Widget::operator=(right);
 
-            // Copy the font and the callback functions
-            m_GlobalFont = right.m_GlobalFont;
+            // Remove all the old widgets, which also releases the old fonts that they were using
+            removeAllWidgets();
+
+            // Share the fonts and copy the callback functions
+            TGUI_FontManager.addUser(right.m_GlobalFont);
+            changeGlobalFont(right.m_GlobalFont);
+            for (std::vector<FontData*>::const_iterator it = right.m_OldGlobalFonts.begin(); it != right.m_OldGlobalFonts.end(); ++it)
+            {
+                if (std::find(m_OldGlobalFonts.begin(), m_OldGlobalFonts.end(), *it) == m_OldGlobalFonts.end())
+                {
+                    TGUI_FontManager.addUser(*it);
+                    m_OldGlobalFonts.push_back(*it);
+                }
+            }
+
             m_ContainerFocused = false;
             m_GlobalCallbackFunctions = right.m_GlobalCallbackFunctions;
 
-            // Remove all the old widgets
-            removeAllWidgets();
+            // The texture itself is not copied, it will be recreated when needed
+            m_CachingEnabled = right.m_CachingEnabled;
+            m_CacheValid = false;
 
             // Copy all the widgets
-            for (unsigned int i=0; i<right.m_EventManager.m_Widgets.size(); ++i)
+            const EventManager& eventManager = right.m_EventManager;
+            for (unsigned int i = eventManager.m_Bottom; i != EventManager::NoEntry; i = eventManager.m_Entries[i].above)
             {
-                m_EventManager.m_Widgets.push_back(right.m_EventManager.m_Widgets[i].clone());
-                m_ObjName.push_back(right.m_ObjName[i]);
+                Widget::Ptr widget = eventManager.m_Entries[i].widget.clone();
+                m_EventManager.addWidget(widget, eventManager.getName(eventManager.m_Entries[i].nameId));
+                m_EventManager.m_Entries.back().font = eventManager.m_Entries[i].font;
+
+                // The copied widget continues where the original was
+                if (eventManager.m_Entries[i].timerId)
+                    m_EventManager.scheduleUpdate(widget.get(), eventManager.m_Entries[i].scheduleTime, eventManager.m_Entries[i].wakeUpTime);
 
-                m_EventManager.m_Widgets.back()->m_Parent = this;
+                widget->m_Parent = this;
+
+                // The copied radio buttons have to use the group of this container
+                if (widget->m_Callback.widgetType == Type_RadioButton)
+                    static_cast<RadioButton*>(widget.get())->joinParentGroup();
             }
         }
 
@@ -100,59 +200,75 @@ namespace tgui
 
     bool Container::setGlobalFont(const std::string& filename)
     {
-        return m_GlobalFont.loadFromFile(filename);
+        FontData* font = TGUI_FontManager.getFont(filename);
+        if (font == nullptr)
+            return false;
+
+        changeGlobalFont(font);
+        markDirty();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::setGlobalFont(const sf::Font& font)
     {
-        m_GlobalFont = font;
+        // The font is only copied when it doesn't belong to the font manager yet
+        if (&font != &getEmptyFont())
+            changeGlobalFont(TGUI_FontManager.copyFont(font));
+        else
+            changeGlobalFont(nullptr);
+
+        markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::Font& Container::getGlobalFont() const
     {
-        return m_GlobalFont;
+        if (m_GlobalFont)
+            return m_GlobalFont->font;
+        else
+            return getEmptyFont();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<Widget::Ptr>& Container::getWidgets()
+    const std::vector<Widget::Ptr>& Container::getWidgets() const
     {
-        return m_EventManager.m_Widgets;
+        return m_EventManager.getWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<sf::String>& Container::getWidgetNames()
+    const std::vector<sf::String>& Container::getWidgetNames() const
     {
-        return m_ObjName;
+        return m_EventManager.getWidgetNames();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::add(const Widget::Ptr& widgetPtr, const sf::String& widgetName)
     {
+        markDirty();
+
         assert(widgetPtr != nullptr);
 
+        // The widget is added before initializing it, so that it can already schedule its updates
+        m_EventManager.addWidget(widgetPtr, widgetName);
+        m_EventManager.m_Entries.back().font = m_GlobalFont;
         widgetPtr->initialize(this);
-        m_EventManager.m_Widgets.push_back(widgetPtr);
-        m_ObjName.push_back(widgetName);
+
+        // Containers may already contain widgets that are waiting for their timer
+        if ((widgetPtr->m_ContainerWidget) || (widgetPtr->m_AnimatedWidget))
+            scheduleChildUpdate(widgetPtr.get(), sf::Time());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (unsigned int i = 0; i < m_ObjName.size(); ++i)
-        {
-            if (m_ObjName[i] == widgetName)
-                return m_EventManager.m_Widgets[i];
-        }
-
-        return nullptr;
+        return m_EventManager.getWidget(widgetName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,36 +291,115 @@ namespace tgui
 
     void Container::remove(Widget* widget)
     {
-        // Loop through every widget
-        for (unsigned int i = 0; i < m_EventManager.m_Widgets.size(); ++i)
+        // Unfocus the widget, just in case it was focused
+        if (m_EventManager.findEntry(widget) != EventManager::NoEntry)
         {
-            // Check if the pointer matches
-            if (m_EventManager.m_Widgets[i].get() == widget)
-            {
-                // Unfocus the widget, just in case it was focused
-                m_EventManager.unfocusWidget(widget);
+            m_EventManager.unfocusWidget(widget);
+            leaveRadioButtonGroup(widget);
+        }
 
-                // Remove the widget
-                m_EventManager.m_Widgets.erase(m_EventManager.m_Widgets.begin() + i);
+        // Remove the widget
+        if (m_EventManager.removeWidget(widget))
+        {
+            markDirty();
+            releaseOldGlobalFonts();
+        }
+    }
 
-                // Also emove the name it from the list
-                m_ObjName.erase(m_ObjName.begin() + i);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                break;
-            }
+    void Container::removeAllWidgets()
+    {
+        if (!m_EventManager.m_Entries.empty())
+            markDirty();
+
+        for (unsigned int i = 0; i < m_EventManager.m_Entries.size(); ++i)
+            leaveRadioButtonGroup(m_EventManager.m_Entries[i].widget.get());
+
+        m_EventManager.removeAllWidgets();
+        releaseOldGlobalFonts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addRange(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        markDirty();
+
+        m_EventManager.reserve(m_EventManager.m_Entries.size() + widgets.size());
+
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+        {
+            if (i < widgetNames.size())
+                add(widgets[i], widgetNames[i]);
+            else
+                add(widgets[i]);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::removeAllWidgets()
+    unsigned int Container::removeIf(const std::function<bool(const Widget::Ptr&)>& predicate)
     {
-        // Clear the lists
-        m_EventManager.m_Widgets.clear();
-        m_ObjName.clear();
+        std::vector<bool> marked(m_EventManager.m_Entries.size(), false);
+        for (unsigned int i = m_EventManager.m_Bottom; i != EventManager::NoEntry; i = m_EventManager.m_Entries[i].above)
+            marked[i] = predicate(m_EventManager.m_Entries[i].widget);
 
-        // There are no more widgets, so none of the widgets can be focused
-        m_EventManager.m_FocusedWidget = 0;
+        return removeMarkedWidgets(marked);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeRange(const std::vector<Widget::Ptr>& widgets)
+    {
+        markDirty();
+
+        std::vector<bool> marked(m_EventManager.m_Entries.size(), false);
+        for (std::vector<Widget::Ptr>::const_iterator it = widgets.begin(); it != widgets.end(); ++it)
+        {
+            unsigned int index = m_EventManager.findEntry(it->get());
+            if (index != EventManager::NoEntry)
+                marked[index] = true;
+        }
+
+        removeMarkedWidgets(marked);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::reserve(unsigned int widgetCount)
+    {
+        m_EventManager.reserve(widgetCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Container::removeMarkedWidgets(const std::vector<bool>& marked)
+    {
+        for (unsigned int i = 0; i < marked.size(); ++i)
+        {
+            if (marked[i])
+                leaveRadioButtonGroup(m_EventManager.m_Entries[i].widget.get());
+        }
+
+        unsigned int removedWidgets = m_EventManager.removeMarkedWidgets(marked);
+        if (removedWidgets > 0)
+            markDirty();
+
+        releaseOldGlobalFonts();
+        return removedWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::leaveRadioButtonGroup(Widget* widget)
+    {
+        if ((widget != nullptr) && (widget->m_Callback.widgetType == Type_RadioButton))
+        {
+            RadioButton* radioButton = static_cast<RadioButton*>(widget);
+            if (radioButton->getGroup() == m_RadioButtonGroup)
+                radioButton->leaveParentGroup();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,107 +427,329 @@ namespace tgui
 
     void Container::uncheckRadioButtons()
     {
-        // Loop through all radio buttons and uncheck them
-        for (unsigned int i = 0; i < m_EventManager.m_Widgets.size(); ++i)
+        // The group knows which radio button is checked, unchecking it marks the radio button as dirty
+        m_RadioButtonGroup->uncheck();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButtonGroup::Ptr Container::getRadioButtonGroup() const
+    {
+        return m_RadioButtonGroup;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::moveWidgetToFront(Widget *const widget)
+    {
+        // The looks of the widget don't change, but its area has to be drawn again when it wasn't in front yet
+        const unsigned int index = m_EventManager.findEntry(widget);
+        if ((index != EventManager::NoEntry) && (index != m_EventManager.m_Top))
+            widget->markChanged();
+
+        m_EventManager.moveWidgetToFront(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::moveWidgetToBack(Widget *const widget)
+    {
+        // The looks of the widget don't change, but its area has to be drawn again when it wasn't in the back yet
+        const unsigned int index = m_EventManager.findEntry(widget);
+        if ((index != EventManager::NoEntry) && (index != m_EventManager.m_Bottom))
+            widget->markChanged();
+
+        m_EventManager.moveWidgetToBack(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setTransparency(unsigned char transparency)
+    {
+        // The cached texture remains valid, it will just be drawn with a different transparency
+        markChanged();
+
+        m_Opacity = transparency;
+
+        // The texture is no longer needed when the container becomes opaque again
+        if ((m_Opacity == 255) && !m_CachingEnabled)
         {
-            if (m_EventManager.m_Widgets[i]->m_Callback.widgetType == Type_RadioButton)
-                static_cast<RadioButton::Ptr>(m_EventManager.m_Widgets[i])->forceUncheck();
+            delete m_CacheTexture;
+            m_CacheTexture = nullptr;
+            m_CacheValid = false;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::moveWidgetToFront(Widget *const widget)
+    void Container::bindGlobalCallback(std::function<void(const Callback&)> func)
+    {
+        m_GlobalCallbackFunctions.push_back(func);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::unbindGlobalCallback()
+    {
+        m_GlobalCallbackFunctions.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_EventManager.m_Widgets.size(); ++i)
+        // Widgets may have been moved or resized since the last frame
+        m_EventManager.updateCachedBounds();
+
+        // Find out which part of the target can still be drawn on (in pixels, with the top of the target at 0)
+        GLint scissor[4] = {0, 0, static_cast<GLint>(target->getSize().x), static_cast<GLint>(target->getSize().y)};
+        if (glIsEnabled(GL_SCISSOR_TEST))
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+        float clipLeft = static_cast<float>(scissor[0]);
+        float clipTop = static_cast<float>(static_cast<GLint>(target->getSize().y) - scissor[1] - scissor[3]);
+        float clipRight = static_cast<float>(scissor[0] + scissor[2]);
+        float clipBottom = static_cast<float>(static_cast<GLint>(target->getSize().y) - scissor[1]);
+
+        m_CulledWidgetCount = 0;
+
+        // Find the widgets that are completely hidden behind the opaque widgets in front of them
+        m_OpaqueAreas.clear();
+        m_OccludedWidgets.assign(m_EventManager.m_Entries.size(), false);
+        for (unsigned int i = m_EventManager.m_Top; i != EventManager::NoEntry; i = m_EventManager.m_Entries[i].below)
         {
-            // Check if the widget is found
-            if (m_EventManager.m_Widgets[i].get() == widget)
+            const EventManager::Entry& entry = m_EventManager.m_Entries[i];
+            if (entry.visible == false)
+                continue;
+
+            for (std::vector<sf::FloatRect>::const_iterator area = m_OpaqueAreas.begin(); area != m_OpaqueAreas.end(); ++area)
             {
-                // Copy the widget
-                m_EventManager.m_Widgets.push_back(m_EventManager.m_Widgets[i]);
-                m_ObjName.push_back(m_ObjName[i]);
+                if ((entry.bounds.left >= area->left) && (entry.bounds.top >= area->top)
+                 && (entry.bounds.left + entry.bounds.width <= area->left + area->width)
+                 && (entry.bounds.top + entry.bounds.height <= area->top + area->height))
+                {
+                    m_OccludedWidgets[i] = true;
+                    break;
+                }
+            }
 
-                // Focus the correct widget
-                if ((m_EventManager.m_FocusedWidget == 0) || (m_EventManager.m_FocusedWidget == i+1))
-                    m_EventManager.m_FocusedWidget = m_EventManager.m_Widgets.size()-1;
-                else if (m_EventManager.m_FocusedWidget > i+1)
-                    --m_EventManager.m_FocusedWidget;
+            // The opaque area of a hidden widget lies inside an area that was already found
+            if (m_OccludedWidgets[i] == false)
+            {
+                sf::FloatRect opaqueArea = entry.widget->getOpaqueArea();
+                if ((opaqueArea.width > 0) && (opaqueArea.height > 0))
+                    m_OpaqueAreas.push_back(sf::FloatRect(entry.bounds.left + opaqueArea.left, entry.bounds.top + opaqueArea.top, opaqueArea.width, opaqueArea.height));
+            }
+        }
 
-                // Remove the old widget
-                m_EventManager.m_Widgets.erase(m_EventManager.m_Widgets.begin() + i);
-                m_ObjName.erase(m_ObjName.begin() + i);
+        // Draw all widgets when they are visible, starting with the one at the back
+        for (unsigned int i = m_EventManager.m_Bottom; i != EventManager::NoEntry; i = m_EventManager.m_Entries[i].above)
+        {
+            const EventManager::Entry& entry = m_EventManager.m_Entries[i];
 
-                break;
+            // Remember where the widget is drawn, so that this area is erased when the widget changes
+            entry.drawnBounds = entry.visible ? entry.bounds : sf::FloatRect();
+            if (entry.visible == false)
+                continue;
+
+            if (TGUI_RenderStats)
+                ++TGUI_RenderStats->widgetsVisited;
+
+            if (m_OccludedWidgets[i])
+            {
+                ++m_CulledWidgetCount;
+                if (TGUI_RenderStats)
+                    ++TGUI_RenderStats->widgetsCulled;
+
+                continue;
             }
+
+            // Skip the widget when it lies completely outside the clipping area.
+            // One pixel is added on each side because the widget may be drawn on rounded positions.
+            sf::Vector2i topLeft = target->mapCoordsToPixel(states.transform.transformPoint(entry.bounds.left, entry.bounds.top));
+            sf::Vector2i bottomRight = target->mapCoordsToPixel(states.transform.transformPoint(entry.bounds.left + entry.bounds.width, entry.bounds.top + entry.bounds.height));
+
+            if (((TGUI_MAXIMUM(topLeft.x, bottomRight.x)) + 1 < clipLeft) || ((TGUI_MINIMUM(topLeft.x, bottomRight.x)) - 1 > clipRight)
+             || ((TGUI_MAXIMUM(topLeft.y, bottomRight.y)) + 1 < clipTop) || ((TGUI_MINIMUM(topLeft.y, bottomRight.y)) - 1 > clipBottom))
+            {
+                ++m_CulledWidgetCount;
+                if (TGUI_RenderStats)
+                    ++TGUI_RenderStats->widgetsCulled;
+
+                continue;
+            }
+
+            if (TGUI_RenderStats)
+            {
+                // Time the widget and count its draw calls, including the ones of the widgets inside it
+                const unsigned int drawCalls = TGUI_RenderStats->drawCalls;
+                sf::Clock clock;
+
+                entry.widget->draw(*target, states);
+
+                WidgetTypeStats& typeStats = TGUI_RenderStats->widgetTypes[entry.widget->m_Callback.widgetType];
+                ++typeStats.widgets;
+                typeStats.drawCalls += TGUI_RenderStats->drawCalls - drawCalls;
+                typeStats.drawTime += clock.getElapsedTime();
+            }
+            else
+                entry.widget->draw(*target, states);
         }
+
+        // The skipped widgets are also counted by the parent
+        if (m_Parent)
+            m_Parent->m_CulledWidgetCount += m_CulledWidgetCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::moveWidgetToBack(Widget *const widget)
+    bool Container::drawCache(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vector2f& size) const
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_EventManager.m_Widgets.size(); ++i)
+        // When the cache is being filled then the draw function has to draw the widgets directly
+        if (&target == m_CacheTexture)
+            return false;
+
+        // Without caching the transparency is applied by the shader, the texture is only needed when shaders aren't supported
+        if ((m_CachingEnabled == false) && ((m_Opacity == 255) || (getOpacityShader() != nullptr)))
+            return false;
+
+        unsigned int width = static_cast<unsigned int>(std::ceil(size.x));
+        unsigned int height = static_cast<unsigned int>(std::ceil(size.y));
+        if ((width == 0) || (height == 0))
+            return true;
+
+        if (m_CacheTexture == nullptr)
+            m_CacheTexture = new sf::RenderTexture();
+
+        // Recreate the texture when the size of the container changed
+        if ((m_CacheTexture->getSize().x != width) || (m_CacheTexture->getSize().y != height))
         {
-            // Check if the widget is found
-            if (m_EventManager.m_Widgets[i].get() == widget)
+            m_CacheValid = false;
+
+            if (!m_CacheTexture->create(width, height))
             {
-                // Copy the widget
-                Widget::Ptr obj = m_EventManager.m_Widgets[i];
-                std::string name = m_ObjName[i];
-                m_EventManager.m_Widgets.insert(m_EventManager.m_Widgets.begin(), obj);
-                m_ObjName.insert(m_ObjName.begin(), name);
-
-                // Focus the correct widget
-                if (m_EventManager.m_FocusedWidget == i + 1)
-                    m_EventManager.m_FocusedWidget = 1;
-                else if (m_EventManager.m_FocusedWidget)
-                    ++m_EventManager.m_FocusedWidget;
-
-                // Remove the old widget
-                m_EventManager.m_Widgets.erase(m_EventManager.m_Widgets.begin() + i + 1);
-                m_ObjName.erase(m_ObjName.begin() + i + 1);
+                TGUI_OUTPUT("TGUI error: Failed to create the cache texture. The container will be drawn without caching.");
 
-                break;
+                delete m_CacheTexture;
+                m_CacheTexture = nullptr;
+                return false;
             }
         }
+
+        // Only draw the widgets again when something changed
+        if (m_Dirty || !m_CacheValid)
+        {
+            m_CacheTexture->setActive(true);
+            m_CacheTexture->clear(sf::Color::Transparent);
+
+            // The draw functions of the widgets expect clipping to be enabled
+            glEnable(GL_SCISSOR_TEST);
+            setScissor(0, 0, width, height);
+
+            // Draw the container in the top left corner of the texture
+            sf::RenderStates cacheStates;
+            cacheStates.transform.translate(-getPosition());
+            draw(*m_CacheTexture, cacheStates);
+
+            m_CacheTexture->display();
+
+            m_CacheValid = true;
+            m_CacheRedrawn = true;
+        }
+
+        sf::Sprite sprite(m_CacheTexture->getTexture());
+        sprite.setPosition(getPosition());
+        sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+        drawCounted(target, sprite, states);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::setTransparency(unsigned char transparency)
+    float Container::applyOpacity(const sf::RenderTarget& target, sf::RenderStates& states) const
     {
-        Widget::setTransparency(transparency);
+        float oldOpacity = currentOpacity;
+
+        // The contents of the cache texture are drawn opaque, the texture itself gets the transparency of the container
+        if ((m_Opacity == 255) || (&target == m_CacheTexture))
+            return oldOpacity;
+
+        sf::Shader* shader = getOpacityShader();
+        if (shader == nullptr)
+            return oldOpacity;
 
-        for (unsigned int i = 0; i < m_EventManager.m_Widgets.size(); ++i)
-            m_EventManager.m_Widgets[i]->setTransparency(transparency);
+        // The opacity of a nested container is multiplied with the opacity of its parents
+        if (states.shader == shader)
+            currentOpacity = oldOpacity * m_Opacity / 255.f;
+        else
+            currentOpacity = m_Opacity / 255.f;
+
+        shader->setParameter("opacity", currentOpacity);
+        states.shader = shader;
+        return oldOpacity;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::bindGlobalCallback(std::function<void(const Callback&)> func)
+    void Container::restoreOpacity(float opacity)
     {
-        m_GlobalCallbackFunctions.push_back(func);
+        if (currentOpacity != opacity)
+        {
+            currentOpacity = opacity;
+            getOpacityShader()->setParameter("opacity", currentOpacity);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::unbindGlobalCallback()
+    void Container::changeGlobalFont(FontData* font)
     {
-        m_GlobalCallbackFunctions.clear();
+        // Don't count the same container twice as user of the font
+        if (font == m_GlobalFont)
+        {
+            TGUI_FontManager.removeFont(font);
+            return;
+        }
+
+        // The old font is kept alive when widgets may still be using it, but it is only stored once
+        if (m_GlobalFont)
+        {
+            if (isFontUsedByWidgets(m_GlobalFont) && (std::find(m_OldGlobalFonts.begin(), m_OldGlobalFonts.end(), m_GlobalFont) == m_OldGlobalFonts.end()))
+                m_OldGlobalFonts.push_back(m_GlobalFont);
+            else
+                TGUI_FontManager.removeFont(m_GlobalFont);
+        }
+
+        m_GlobalFont = font;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
+    bool Container::isFontUsedByWidgets(const FontData* font) const
     {
-        // Draw all widgets when they are visible
-        for (unsigned int i = 0; i < m_EventManager.m_Widgets.size(); ++i)
+        for (std::vector<EventManager::Entry>::const_iterator it = m_EventManager.m_Entries.begin(); it != m_EventManager.m_Entries.end(); ++it)
         {
-            if (m_EventManager.m_Widgets[i]->m_Visible)
-                m_EventManager.m_Widgets[i]->draw(*target, states);
+            if (it->font == font)
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::releaseOldGlobalFonts()
+    {
+        unsigned int i = 0;
+        while (i < m_OldGlobalFonts.size())
+        {
+            if (isFontUsedByWidgets(m_OldGlobalFonts[i]))
+                ++i;
+            else
+            {
+                TGUI_FontManager.removeFont(m_OldGlobalFonts[i]);
+                m_OldGlobalFonts.erase(m_OldGlobalFonts.begin() + i);
+            }
         }
     }
 
@@ -624,6 +1041,8 @@ namespace tgui
 
     bool Container::loadWidgetsFromFile(const std::string& filename)
     {
+        TGUI_PROFILE_ZONE("Container::loadWidgetsFromFile");
+
 /// \todo This function should be rewritten.
 /// \todo All widgets should be capable of loading themselves out of a string.
 /// \todo Perhaps it would be better to switch to xml parsing.
@@ -2436,6 +2855,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::enableCaching(bool enabled)
+    {
+        markDirty();
+
+        m_CachingEnabled = enabled;
+        m_CacheValid = false;
+
+        // Release the texture memory when it is no longer used
+        if (!enabled)
+        {
+            delete m_CacheTexture;
+            m_CacheTexture = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isCachingEnabled() const
+    {
+        return m_CachingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Container::getCulledWidgetCount() const
+    {
+        return m_CulledWidgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::addChildCallback(const Callback& callback)
     {
         // If there is no global callback function then send the callback to the parent
@@ -2451,6 +2901,128 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childStateChanged(const Widget* widget)
+    {
+        m_EventManager.updateWidgetState(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childChanged(const Widget* widget)
+    {
+        m_EventManager.invalidateBounds(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::clearDirtyFlags()
+    {
+        // The cached texture is outdated when the container changed without being drawn
+        if (m_Dirty && !m_CacheRedrawn)
+            m_CacheValid = false;
+
+        m_CacheRedrawn = false;
+        m_Dirty = false;
+        m_Changed = false;
+
+        // A widget that isn't dirty can't have dirty children, so only the changed branches have to be visited
+        for (std::vector<EventManager::Entry>::iterator it = m_EventManager.m_Entries.begin(); it != m_EventManager.m_Entries.end(); ++it)
+        {
+            if (it->widget->m_Dirty || it->widget->m_Changed)
+            {
+                if (it->widget->m_ContainerWidget)
+                    static_cast<Container*>(it->widget.get())->clearDirtyFlags();
+                else
+                {
+                    it->widget->m_Dirty = false;
+                    it->widget->m_Changed = false;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::collectDamagedAreas(std::vector<sf::FloatRect>& areas, const sf::Vector2f& offset) const
+    {
+        m_EventManager.updateCachedBounds();
+
+        for (std::vector<EventManager::Entry>::const_iterator it = m_EventManager.m_Entries.begin(); it != m_EventManager.m_Entries.end(); ++it)
+        {
+            const Widget* widget = it->widget.get();
+            if ((widget->m_Dirty == false) && (widget->m_Changed == false))
+                continue;
+
+            // When only the children of a container changed then only their areas have to be redrawn
+            if (widget->m_ContainerWidget && (widget->m_Changed == false))
+            {
+                const Container* container = static_cast<const Container*>(widget);
+                container->collectDamagedAreas(areas, offset + widget->getPosition() + container->getWidgetsOffset());
+                continue;
+            }
+
+            // The area where the widget was drawn last time has to be erased
+            if ((it->drawnBounds.width > 0) && (it->drawnBounds.height > 0))
+                areas.push_back(sf::FloatRect(it->drawnBounds.left + offset.x, it->drawnBounds.top + offset.y, it->drawnBounds.width, it->drawnBounds.height));
+
+            // A hidden widget isn't drawn anywhere
+            it->drawnBounds = it->visible ? it->bounds : sf::FloatRect();
+
+            // The widget has to be drawn on its new place
+            if (it->visible)
+                areas.push_back(sf::FloatRect(it->bounds.left + offset.x, it->bounds.top + offset.y, it->bounds.width, it->bounds.height));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f Container::getWidgetsOffset() const
+    {
+        return sf::Vector2f(0, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::scheduleChildUpdate(const Widget* widget, const sf::Time& delay)
+    {
+        sf::Time currentTime = getAnimationTime();
+        scheduleChildUpdateAt(widget, currentTime, currentTime + delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::cancelChildUpdate(const Widget* widget)
+    {
+        // When this container is woken up for nothing then it will just go back to sleep
+        m_EventManager.cancelScheduledUpdate(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebaseTimers(const sf::Time& offset)
+    {
+        m_EventManager.rebaseTimers(offset);
+
+        for (unsigned int i = 0; i < m_EventManager.m_Entries.size(); ++i)
+        {
+            if (m_EventManager.m_Entries[i].widget->m_ContainerWidget)
+                static_cast<Container*>(m_EventManager.m_Entries[i].widget.get())->rebaseTimers(offset);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Container::getAnimationTime() const
+    {
+        // Only the event manager of the gui keeps track of the time
+        if (m_Parent)
+            return m_Parent->getAnimationTime();
+        else
+            return m_EventManager.m_Time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(float x, float y)
     {
         sf::Event event;
@@ -2553,7 +3125,11 @@ namespace tgui
 
     void Container::initialize(Container *const parent)
     {
-        m_Parent = parent;
+        // Timers that were scheduled before the container had a parent have to use the time of the gui from now on
+        if (m_Parent == nullptr)
+            rebaseTimers(parent->getAnimationTime() - m_EventManager.m_Time);
+
+        Widget::initialize(parent);
         setGlobalFont(m_Parent->getGlobalFont());
     }
 
@@ -2561,8 +3137,25 @@ namespace tgui
 
     void Container::update()
     {
-        m_EventManager.updateTime(m_AnimationTimeElapsed);
+        // The time of the gui is used instead of the elapsed time
         m_AnimationTimeElapsed = sf::Time();
+
+        sf::Time currentTime = getAnimationTime();
+        m_EventManager.processTimers(currentTime);
+
+        // Make sure that this container is woken up again when the next child widget needs it
+        sf::Time wakeUpTime;
+        if ((m_Parent) && (m_EventManager.getNextWakeUpTime(wakeUpTime)))
+            m_Parent->scheduleChildUpdateAt(this, currentTime, wakeUpTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::scheduleChildUpdateAt(const Widget* widget, const sf::Time& currentTime, const sf::Time& wakeUpTime)
+    {
+        // When the timer is the first one to expire in this container then the container must be woken up earlier as well
+        if (m_EventManager.scheduleUpdate(widget, currentTime, wakeUpTime) && (m_Parent))
+            m_Parent->scheduleChildUpdateAt(this, currentTime, wakeUpTime);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2590,7 +3183,7 @@ namespace tgui
 
     sf::Vector2f GuiContainer::getSize() const
     {
-        return sf::Vector2f(m_Window->getSize());
+        return sf::Vector2f(m_Target->getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
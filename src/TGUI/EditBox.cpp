@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/EditBox.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +57,6 @@ namespace tgui
     m_SeparateHoverImage    (false)
     {
         m_Callback.widgetType = Type_EditBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
 
         m_SelectionPoint.setSize(sf::Vector2f(1, 0));
@@ -88,6 +89,9 @@ namespace tgui
     m_TextSelection         (copy.m_TextSelection),
     m_TextAfterSelection    (copy.m_TextAfterSelection),
     m_TextFull              (copy.m_TextFull),
+    m_SpriteNormal          (copy.m_SpriteNormal),
+    m_SpriteHover           (copy.m_SpriteHover),
+    m_SpriteFocused         (copy.m_SpriteFocused),
     m_PossibleDoubleClick   (copy.m_PossibleDoubleClick),
     m_NumbersOnly           (copy.m_NumbersOnly),
     m_SeparateHoverImage    (copy.m_SeparateHoverImage)
@@ -159,6 +163,9 @@ namespace tgui
             std::swap(m_TextureFocused_L,       temp.m_TextureFocused_L);
             std::swap(m_TextureFocused_M,       temp.m_TextureFocused_M);
             std::swap(m_TextureFocused_R,       temp.m_TextureFocused_R);
+            std::swap(m_SpriteNormal,           temp.m_SpriteNormal);
+            std::swap(m_SpriteHover,            temp.m_SpriteHover);
+            std::swap(m_SpriteFocused,          temp.m_SpriteFocused);
             std::swap(m_PossibleDoubleClick,    temp.m_PossibleDoubleClick);
             std::swap(m_NumbersOnly,            temp.m_NumbersOnly);
             std::swap(m_SeparateHoverImage,     temp.m_SeparateHoverImage);
@@ -178,6 +185,10 @@ namespace tgui
 
     bool EditBox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("EditBox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -371,6 +382,7 @@ namespace tgui
             if ((m_TextureNormal_L.data != nullptr) && (m_TextureNormal_M.data != nullptr) && (m_TextureNormal_R.data != nullptr))
             {
                 m_Loaded = true;
+                m_SpriteNormal.setTextures(m_TextureNormal_L, m_TextureNormal_M, m_TextureNormal_R);
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
             }
@@ -385,11 +397,16 @@ namespace tgui
             {
                 m_AllowFocus = true;
                 m_WidgetPhase |= WidgetPhase_Focused;
+                m_SpriteFocused.setTextures(m_TextureFocused_L, m_TextureFocused_M, m_TextureFocused_R);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
+                m_SpriteHover.setTextures(m_TextureHover_L, m_TextureHover_M, m_TextureHover_R);
             }
+
+            // Recalculate the sprites now that all images are known
+            setSize(m_Size.x, m_Size.y);
         }
         else // The image isn't split
         {
@@ -435,31 +452,15 @@ namespace tgui
 
     void EditBox::setPosition(float x, float y)
     {
+        markDirty();
+
         Transformable::setPosition(x, y);
 
         if (m_SplitImage)
         {
-            m_TextureHover_L.sprite.setPosition(x, y);
-            m_TextureNormal_L.sprite.setPosition(x, y);
-            m_TextureFocused_L.sprite.setPosition(x, y);
-
-            // Check if the middle image may be drawn
-            if ((m_TextureNormal_M.sprite.getScale().y * (m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x)) < m_Size.x)
-            {
-                m_TextureHover_M.sprite.setPosition(x + (m_TextureHover_L.getWidth() * m_TextureHover_L.sprite.getScale().x), y);
-                m_TextureNormal_M.sprite.setPosition(x + (m_TextureNormal_L.getWidth() * m_TextureNormal_L.sprite.getScale().x), y);
-                m_TextureFocused_M.sprite.setPosition(x + (m_TextureFocused_L.getWidth() * m_TextureFocused_L.sprite.getScale().x), y);
-
-                m_TextureHover_R.sprite.setPosition(m_TextureHover_M.sprite.getPosition().x + (m_TextureHover_M.getWidth() * m_TextureHover_M.sprite.getScale().x), y);
-                m_TextureNormal_R.sprite.setPosition(m_TextureNormal_M.sprite.getPosition().x + (m_TextureNormal_M.getWidth() * m_TextureNormal_M.sprite.getScale().x), y);
-                m_TextureFocused_R.sprite.setPosition(m_TextureFocused_M.sprite.getPosition().x + (m_TextureFocused_M.getWidth() * m_TextureFocused_M.sprite.getScale().x), y);
-            }
-            else // The middle image isn't drawn
-            {
-                m_TextureHover_R.sprite.setPosition(x + (m_TextureHover_L.getWidth() * m_TextureHover_L.sprite.getScale().x), y);
-                m_TextureNormal_R.sprite.setPosition(x + (m_TextureNormal_L.getWidth() * m_TextureNormal_L.sprite.getScale().x), y);
-                m_TextureFocused_R.sprite.setPosition(x + (m_TextureFocused_L.getWidth() * m_TextureFocused_L.sprite.getScale().x), y);
-            }
+            m_SpriteHover.setPosition(x, y);
+            m_SpriteNormal.setPosition(x, y);
+            m_SpriteFocused.setPosition(x, y);
         }
         else // The images aren't split
         {
@@ -475,6 +476,8 @@ namespace tgui
 
     void EditBox::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -501,32 +504,9 @@ namespace tgui
         // Drawing the edit box image will be different when the image is split
         if (m_SplitImage)
         {
-            m_TextureHover_L.sprite.setScale(m_Size.y / m_TextureNormal_M.getSize().y, m_Size.y / m_TextureNormal_M.getSize().y);
-            m_TextureNormal_L.sprite.setScale(m_Size.y / m_TextureNormal_M.getSize().y, m_Size.y / m_TextureNormal_M.getSize().y);
-            m_TextureFocused_L.sprite.setScale(m_Size.y / m_TextureNormal_M.getSize().y, m_Size.y / m_TextureNormal_M.getSize().y);
-
-            // Check if the middle image may be drawn
-            if (((m_Size.y / m_TextureNormal_M.getSize().y) * (m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x)) < m_Size.x)
-            {
-                // Calculate the scale for our middle image
-                float scaleX = (m_Size.x / m_TextureNormal_M.getSize().x) -
-                               (((m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x) * (m_Size.y / m_TextureNormal_M.getSize().y))
-                                / m_TextureNormal_M.getSize().x);
-
-                m_TextureHover_M.sprite.setScale(scaleX, m_Size.y / m_TextureNormal_M.getSize().y);
-                m_TextureNormal_M.sprite.setScale(scaleX, m_Size.y / m_TextureNormal_M.getSize().y);
-                m_TextureFocused_M.sprite.setScale(scaleX, m_Size.y / m_TextureNormal_M.getSize().y);
-            }
-            else // The middle image is not drawn
-            {
-                m_TextureHover_M.sprite.setScale(0, 0);
-                m_TextureNormal_M.sprite.setScale(0, 0);
-                m_TextureFocused_M.sprite.setScale(0, 0);
-            }
-
-            m_TextureHover_R.sprite.setScale(m_Size.y / m_TextureNormal_M.getSize().y, m_Size.y / m_TextureNormal_M.getSize().y);
-            m_TextureNormal_R.sprite.setScale(m_Size.y / m_TextureNormal_M.getSize().y, m_Size.y / m_TextureNormal_M.getSize().y);
-            m_TextureFocused_R.sprite.setScale(m_Size.y / m_TextureNormal_M.getSize().y, m_Size.y / m_TextureNormal_M.getSize().y);
+            m_SpriteHover.setSize(m_Size.x, m_Size.y);
+            m_SpriteNormal.setSize(m_Size.x, m_Size.y);
+            m_SpriteFocused.setSize(m_Size.x, m_Size.y);
         }
         else // The image is not split
         {
@@ -547,6 +527,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        markDirty();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -557,7 +539,7 @@ namespace tgui
             // Calculate the text size
             m_TextFull.setString("kg");
             m_TextFull.setCharacterSize(static_cast<unsigned int>(m_Size.y - ((m_TopBorder + m_BottomBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
-            m_TextFull.setCharacterSize(static_cast<unsigned int>(m_TextFull.getCharacterSize() - m_TextFull.getLocalBounds().top));
+            m_TextFull.setCharacterSize(static_cast<unsigned int>(m_TextFull.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_TextFull).top));
             m_TextFull.setString(m_DisplayedText);
 
             // Also adjust the character size of the other texts
@@ -619,13 +601,19 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x > width)
-            {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                m_Text.erase(m_Text.getSize()-1);
-                m_DisplayedText.erase(m_DisplayedText.getSize()-1);
+            const std::vector<sf::Vector2f>& positions = TGUI_TextMeasurementCache.getCharacterPositions(m_TextBeforeSelection);
+            const sf::Transform& transform = m_TextBeforeSelection.getTransform();
+
+            // Find out how many characters fit inside the EditBox
+            unsigned int length = m_DisplayedText.getSize();
+            while ((length > 0) && (transform.transformPoint(positions[length]).x > width))
+                --length;
 
-                // Set the new text
+            // The characters that don't fit inside the EditBox must be deleted
+            if (length < m_DisplayedText.getSize())
+            {
+                m_Text.erase(length, sf::String::InvalidPos);
+                m_DisplayedText.erase(length, sf::String::InvalidPos);
                 m_TextBeforeSelection.setString(m_DisplayedText);
             }
 
@@ -635,7 +623,7 @@ namespace tgui
         else // There is no text cropping
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x;
 
             // If the text can be moved to the right then do so
             if (textWidth > width)
@@ -662,6 +650,8 @@ namespace tgui
 
     void EditBox::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Change the text size
         m_TextSize = size;
 
@@ -680,10 +670,13 @@ namespace tgui
 
     void EditBox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_TextBeforeSelection.setFont(font);
         m_TextSelection.setFont(font);
         m_TextAfterSelection.setFont(font);
         m_TextFull.setFont(font);
+        TGUI_FontManager.trackText(m_TextFull);
 
         recalculateTextPositions();
     }
@@ -699,6 +692,8 @@ namespace tgui
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        markDirty();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -721,6 +716,8 @@ namespace tgui
 
     void EditBox::setMaximumCharacters(unsigned int maxChars)
     {
+        markDirty();
+
         // Set the new character limit ( 0 to disable the limit )
         m_MaxChars = maxChars;
 
@@ -753,6 +750,8 @@ namespace tgui
 
     void EditBox::setBorders(unsigned int borderLeft, unsigned int borderTop, unsigned int borderRight, unsigned int borderBottom)
     {
+        markDirty();
+
         // Set the new border size
         m_LeftBorder   = borderLeft;
         m_TopBorder    = borderTop;
@@ -774,6 +773,8 @@ namespace tgui
                                const sf::Color& selectedBgrColor,
                                const sf::Color& selectionPointColor)
     {
+        markDirty();
+
         m_TextBeforeSelection.setColor(color);
         m_TextSelection.setColor(selectedColor);
         m_TextAfterSelection.setColor(color);
@@ -786,6 +787,8 @@ namespace tgui
 
     void EditBox::setTextColor(const sf::Color& textColor)
     {
+        markDirty();
+
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection.setColor(textColor);
     }
@@ -794,6 +797,8 @@ namespace tgui
 
     void EditBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        markDirty();
+
         m_TextSelection.setColor(selectedTextColor);
     }
 
@@ -801,6 +806,8 @@ namespace tgui
 
     void EditBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
+        markDirty();
+
         m_SelectedTextBackground.setFillColor(selectedTextBackgroundColor);
     }
 
@@ -808,6 +815,8 @@ namespace tgui
 
     void EditBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
+        markDirty();
+
         m_SelectionPoint.setFillColor(selectionPointColor);
     }
 
@@ -859,24 +868,28 @@ namespace tgui
             if (width < 0)
                 width = 0;
 
-            // Now check if the text fits into the EditBox
-            while (m_TextBeforeSelection.findCharacterPos(m_DisplayedText.getSize()).x > width)
-            {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                m_Text.erase(m_Text.getSize()-1);
-                m_DisplayedText.erase(m_DisplayedText.getSize()-1);
-                m_TextBeforeSelection.setString(m_DisplayedText);
-            }
-
-            // The full text might have changed
+            // Now check if the whole text fits into the EditBox
             m_TextFull.setString(m_DisplayedText);
+            const std::vector<sf::Vector2f>& positions = TGUI_TextMeasurementCache.getCharacterPositions(m_TextFull);
+            const sf::Transform& transform = m_TextFull.getTransform();
+
+            // Find out how many characters fit inside the EditBox
+            unsigned int length = m_DisplayedText.getSize();
+            while ((length > 0) && (transform.transformPoint(positions[length]).x > width))
+                --length;
 
             // There is no clipping
             m_TextCropPosition = 0;
 
-            // If the selection point was behind the limit, then set it at the end
-            if (m_SelEnd > m_DisplayedText.getSize())
-                setSelectionPointPosition(m_SelEnd);
+            // The characters that don't fit inside the EditBox must be deleted
+            if (length < m_DisplayedText.getSize())
+            {
+                m_Text.erase(length, sf::String::InvalidPos);
+                m_DisplayedText.erase(length, sf::String::InvalidPos);
+
+                // The selected text might have been erased, so the selection is removed and the texts are updated
+                setSelectionPointPosition(TGUI_MINIMUM(m_SelEnd, length));
+            }
         }
     }
 
@@ -884,6 +897,8 @@ namespace tgui
 
     void EditBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        markDirty();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -914,7 +929,7 @@ namespace tgui
                 width = 0;
 
             // Find out the position of the selection point
-            float selectionPointPosition = m_TextFull.findCharacterPos(m_SelEnd).x;
+            float selectionPointPosition = TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_SelEnd).x;
 
             if (m_SelEnd == m_DisplayedText.getSize())
                 selectionPointPosition += m_TextFull.getCharacterSize() / 10.f;
@@ -935,6 +950,8 @@ namespace tgui
 
     void EditBox::setSelectionPointWidth(unsigned int width)
     {
+        markDirty();
+
         m_SelectionPoint.setPosition(m_SelectionPoint.getPosition().x + ((m_SelectionPoint.getSize().x - width) / 2.0f), m_SelectionPoint.getPosition().y);
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(width),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
@@ -952,6 +969,8 @@ namespace tgui
 
     void EditBox::setNumbersOnly(bool numbersOnly)
     {
+        markDirty();
+
         m_NumbersOnly = numbersOnly;
 
         // Remove all letters from the edit box if needed
@@ -983,17 +1002,15 @@ namespace tgui
 
     void EditBox::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_SplitImage)
         {
-            m_TextureNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureHover_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureFocused_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-
-            m_TextureNormal_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureHover_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-            m_TextureFocused_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteNormal.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteHover.setColor(sf::Color(255, 255, 255, m_Opacity));
+            m_SpriteFocused.setColor(sf::Color(255, 255, 255, m_Opacity));
         }
 
         m_TextureNormal_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -1013,6 +1030,8 @@ namespace tgui
 
     void EditBox::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         // Calculate the space inside the edit box
         float width;
         if (m_SplitImage)
@@ -1085,7 +1104,7 @@ namespace tgui
 
         // The selection point should be visible
         m_SelectionPointVisible = true;
-        m_AnimationTimeElapsed = sf::Time();
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1104,6 +1123,9 @@ namespace tgui
         // Check if the mouse is hold down (we are selecting multiple characters)
         if (m_MouseDown)
         {
+            // The selection or the visible part of the text may change
+            markDirty();
+
             // Check if there is a text width limit
             if (m_LimitTextWidth)
             {
@@ -1145,19 +1167,19 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width))
+                else if ((x - getPosition().x > (m_LeftBorder * scalingX) + width) && (TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x > width))
                 {
                     // Move the text by a few pixels
                     if (m_TextFull.getCharacterSize() > 10)
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10))
+                        if (m_TextCropPosition + width < TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10))
                             m_TextCropPosition += static_cast<unsigned int>(std::floor(m_TextFull.getCharacterSize() / 10.f + 0.5f));
                         else
-                            m_TextCropPosition = static_cast<unsigned int>(m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10) - width);
+                            m_TextCropPosition = static_cast<unsigned int>(TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x + (m_TextFull.getCharacterSize() / 10) - width);
                     }
                     else
                     {
-                        if (m_TextCropPosition + width < m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x)
+                        if (m_TextCropPosition + width < TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x)
                             ++m_TextCropPosition;
                     }
                 }
@@ -1222,6 +1244,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Check if one of the correct keys was pressed
         if (key == sf::Keyboard::Left)
         {
@@ -1243,7 +1267,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::Right)
         {
@@ -1265,7 +1289,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::Home)
         {
@@ -1274,7 +1298,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::End)
         {
@@ -1283,7 +1307,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::Return)
         {
@@ -1323,7 +1347,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x;
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1339,7 +1363,7 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
             // Add the callback (if the user requested it)
             if (m_CallbackFunctions[TextChanged].empty() == false)
@@ -1377,7 +1401,7 @@ namespace tgui
                     width = 0;
 
                 // Calculate the text width
-                float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+                float textWidth = TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x;
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -1393,7 +1417,7 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
             // Add the callback (if the user requested it)
             if (m_CallbackFunctions[TextChanged].empty() == false)
@@ -1414,6 +1438,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // If only numbers are supported then make sure the input is valid
         if (m_NumbersOnly)
         {
@@ -1479,7 +1505,7 @@ namespace tgui
         if (m_LimitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x > width)
+            if (TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x > width)
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_Text.erase(m_SelEnd, 1);
@@ -1493,7 +1519,7 @@ namespace tgui
 
         // The selection point should be visible again
         m_SelectionPointVisible = true;
-        m_AnimationTimeElapsed = sf::Time();
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
         // Add the callback (if the user requested it)
         if (m_CallbackFunctions[TextChanged].empty() == false)
@@ -1506,8 +1532,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::widgetFocused()
+    {
+        markDirty();
+
+        // Start blinking the selection point
+        m_SelectionPointVisible = true;
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::widgetUnfocused()
     {
+        markDirty();
+
         // If there is a selection then undo it now
         if (m_SelChars)
             setSelectionPointPosition(m_SelEnd);
@@ -1649,6 +1690,9 @@ namespace tgui
         if (m_DisplayedText.isEmpty())
             return 0;
 
+        // Get the positions of all characters at once, instead of looking up the text for every character
+        const std::vector<sf::Vector2f>& positions = TGUI_TextMeasurementCache.getCharacterPositions(m_TextFull);
+
         // Find out what the first visible character is
         unsigned int firstVisibleChar;
         if (m_TextCropPosition)
@@ -1657,13 +1701,12 @@ namespace tgui
             firstVisibleChar = m_SelEnd;
 
             // Go backwards to find the character
-            while (m_TextFull.findCharacterPos(firstVisibleChar-1).x > m_TextCropPosition)
+            while ((firstVisibleChar > 0) && (positions[firstVisibleChar-1].x > m_TextCropPosition))
                 --firstVisibleChar;
         }
         else // If the first part is visible then the first character is also visible
             firstVisibleChar = 0;
 
-        sf::String tempString;
         float textWidthWithoutLastChar;
         float fullTextWidth;
         float halfOfLastCharWidth;
@@ -1685,7 +1728,7 @@ namespace tgui
         if (m_TextAlignment != Alignment::Left)
         {
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = positions[m_DisplayedText.getSize()].x;
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1702,43 +1745,26 @@ namespace tgui
         lastVisibleChar = m_SelEnd;
 
         // Go forward to find the character
-        while (m_TextFull.findCharacterPos(lastVisibleChar+1).x < m_TextCropPosition + width)
-        {
-            if (lastVisibleChar == m_DisplayedText.getSize())
-                break;
-
+        while ((lastVisibleChar < m_DisplayedText.getSize()) && (positions[lastVisibleChar+1].x < m_TextCropPosition + width))
             ++lastVisibleChar;
-        }
-
-        // Set the first part of the text
-        tempString = m_DisplayedText.toWideString().substr(0, firstVisibleChar);
-        m_TextFull.setString(tempString);
 
         // Calculate the first position
-        fullTextWidth = m_TextFull.findCharacterPos(firstVisibleChar).x;
+        fullTextWidth = positions[firstVisibleChar].x;
 
         // for all the other characters, check where you have clicked.
         for (unsigned int i = firstVisibleChar; i < lastVisibleChar; ++i)
         {
-            // Add the next character to the temporary string
-            tempString += m_DisplayedText[i];
-            m_TextFull.setString(tempString);
-
             // Make some calculations
             textWidthWithoutLastChar = fullTextWidth;
-            fullTextWidth = m_TextFull.findCharacterPos(i + 1).x;
+            fullTextWidth = positions[i + 1].x;
             halfOfLastCharWidth = (fullTextWidth - textWidthWithoutLastChar) / 2.0f;
 
             // Check if you have clicked on the first halve of that character
             if (posX < textWidthWithoutLastChar + pixelsToMove + halfOfLastCharWidth - m_TextCropPosition)
-            {
-                m_TextFull.setString(m_DisplayedText);
                 return i;
-            }
         }
 
         // If you pass here then you clicked behind all the characters
-        m_TextFull.setString(m_DisplayedText);
         return lastVisibleChar;
     }
 
@@ -1778,7 +1804,7 @@ namespace tgui
             width = 0;
 
         // Calculate the text width
-        float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+        float textWidth = TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x;
 
         // If the text can be moved to the right then do so
         if (textWidth > width)
@@ -1794,6 +1820,8 @@ namespace tgui
 
     void EditBox::recalculateTextPositions()
     {
+        TGUI_PROFILE_ZONE("EditBox::recalculateTextPositions");
+
         float textX = getPosition().x;
         float textY = getPosition().y;
 
@@ -1817,7 +1845,7 @@ namespace tgui
             float width = m_Size.x - ((m_LeftBorder + m_RightBorder) * borderScale);
 
             // Calculate the text width
-            float textWidth = m_TextFull.findCharacterPos(m_DisplayedText.getSize()).x;
+            float textWidth = TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_DisplayedText.getSize()).x;
 
             // Check if a layout would make sense
             if (textWidth < width)
@@ -1835,7 +1863,8 @@ namespace tgui
         // Set the position of the text
         sf::Text tempText(m_TextFull);
         tempText.setString("kg");
-        textY += (((m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y)) - tempText.getLocalBounds().height) * 0.5f) - tempText.getLocalBounds().top;
+        const sf::FloatRect textBounds = TGUI_TextMeasurementCache.getLocalBounds(tempText);
+        textY += (((m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y)) - textBounds.height) * 0.5f) - textBounds.top;
 
         // Set the text before the selection on the correct position
         m_TextBeforeSelection.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
@@ -1847,10 +1876,10 @@ namespace tgui
             if (m_TextBeforeSelection.getString().getSize() > 0)
                 textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[m_TextBeforeSelection.getString().getSize() - 1], m_DisplayedText[m_TextBeforeSelection.getString().getSize()], m_TextBeforeSelection.getCharacterSize());
 
-            textX += m_TextBeforeSelection.findCharacterPos(m_TextBeforeSelection.getString().getSize()).x - m_TextBeforeSelection.getPosition().x;
+            textX += TGUI_TextMeasurementCache.findCharacterPos(m_TextBeforeSelection, m_TextBeforeSelection.getString().getSize()).x - m_TextBeforeSelection.getPosition().x;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_SelectedTextBackground.setSize(sf::Vector2f(m_TextSelection.findCharacterPos(m_TextSelection.getString().getSize()).x - m_TextSelection.getPosition().x,
+            m_SelectedTextBackground.setSize(sf::Vector2f(TGUI_TextMeasurementCache.findCharacterPos(m_TextSelection, m_TextSelection.getString().getSize()).x - m_TextSelection.getPosition().x,
                                                       (m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y))));
             m_SelectedTextBackground.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
 
@@ -1862,12 +1891,12 @@ namespace tgui
                 textX += m_TextBeforeSelection.getFont()->getKerning(m_DisplayedText[m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize() - 1], m_DisplayedText[m_TextBeforeSelection.getString().getSize() + m_TextSelection.getString().getSize()], m_TextBeforeSelection.getCharacterSize());
 
             // Set the text selected text on the correct position
-            textX += m_TextSelection.findCharacterPos(m_TextSelection.getString().getSize()).x  - m_TextSelection.getPosition().x;
+            textX += TGUI_TextMeasurementCache.findCharacterPos(m_TextSelection, m_TextSelection.getString().getSize()).x  - m_TextSelection.getPosition().x;
             m_TextAfterSelection.setPosition(std::floor(textX + 0.5f), std::floor(textY + 0.5f));
         }
 
         // Set the position of the selection point
-        selectionPointLeft += m_TextFull.findCharacterPos(m_SelEnd).x - (m_SelectionPoint.getSize().x * 0.5f);
+        selectionPointLeft += TGUI_TextMeasurementCache.findCharacterPos(m_TextFull, m_SelEnd).x - (m_SelectionPoint.getSize().x * 0.5f);
         m_SelectionPoint.setPosition(std::floor(selectionPointLeft + 0.5f), std::floor((m_TopBorder * scaling.y) + getPosition().y + 0.5f));
     }
 
@@ -1883,89 +1912,76 @@ namespace tgui
 
     void EditBox::update()
     {
-        // Only show/hide the selection point every half second
-        if (m_AnimationTimeElapsed < sf::milliseconds(500))
-            return;
-
         // Reset the elapsed time
         m_AnimationTimeElapsed = sf::Time();
 
-        // Only update when the editbox is visible
-        if (m_Visible == false)
+        // Too slow for double clicking
+        m_PossibleDoubleClick = false;
+
+        // The selection point only blinks while the editbox is focused
+        if (m_Focused == false)
             return;
 
         // Switch the value of the visible flag
-        m_SelectionPointVisible = !m_SelectionPointVisible;
+        if (m_Visible)
+        {
+            m_SelectionPointVisible = !m_SelectionPointVisible;
+            markDirty();
+        }
 
-        // Too slow for double clicking
-        m_PossibleDoubleClick = false;
+        // Show/hide the selection point again after half a second
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("EditBox::draw");
+
         if (m_SplitImage)
         {
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
-                }
+                    drawCounted(target, m_SpriteHover, states);
                 else
-                {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
-                }
+                    drawCounted(target, m_SpriteNormal, states);
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_L, states);
-                target.draw(m_TextureNormal_M, states);
-                target.draw(m_TextureNormal_R, states);
+                drawCounted(target, m_SpriteNormal, states);
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
-                }
+                    drawCounted(target, m_SpriteHover, states);
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-            {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
-            }
+                drawCounted(target, m_SpriteFocused, states);
         }
         else // The images aren't split
         {
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureHover_M, states);
+                    drawCounted(target, m_TextureHover_M, states);
                 else
-                    target.draw(m_TextureNormal_M, states);
+                    drawCounted(target, m_TextureNormal_M, states);
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_M, states);
+                drawCounted(target, m_TextureNormal_M, states);
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureHover_M, states);
+                    drawCounted(target, m_TextureHover_M, states);
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-                target.draw(m_TextureFocused_M, states);
+                drawCounted(target, m_TextureFocused_M, states);
         }
 
         // Calculate the scaling
@@ -2007,24 +2023,24 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
-        target.draw(m_TextBeforeSelection, states);
+        drawCounted(target, m_TextBeforeSelection, states);
 
         if (m_TextSelection.getString().isEmpty() == false)
         {
-            target.draw(m_SelectedTextBackground, states);
+            drawCounted(target, m_SelectedTextBackground, states);
 
-            target.draw(m_TextSelection, states);
-            target.draw(m_TextAfterSelection, states);
+            drawCounted(target, m_TextSelection, states);
+            drawCounted(target, m_TextAfterSelection, states);
         }
 
         // Draw the selection point
         if ((m_Focused) && (m_SelectionPointVisible))
-            target.draw(m_SelectionPoint, states);
+            drawCounted(target, m_SelectionPoint, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,9 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/EventManager.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,8 +37,18 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const unsigned int EventManager::NoEntry;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     EventManager::EventManager() :
-    m_FocusedWidget(0)
+    m_Bottom                (NoEntry),
+    m_Top                   (NoEntry),
+    m_FocusedWidget         (0),
+    m_OrderedListsNeedUpdate(false),
+    m_LastTimerId           (0),
+    m_Names                 (1),
+    m_NameUsers             (1, 0)
     {
     }
 
@@ -43,19 +56,23 @@ namespace tgui
 
     bool EventManager::handleEvent(sf::Event& event)
     {
+        TGUI_PROFILE_ZONE("EventManager::handleEvent");
+
         // Check if a mouse button has moved
         if (event.type == sf::Event::MouseMoved)
         {
             // Loop through all widgets
-            for (unsigned int i=0; i<m_Widgets.size(); ++i)
+            for (unsigned int i = m_Bottom; i != NoEntry; i = m_Entries[i].above)
             {
+                Widget::Ptr& widget = m_Entries[i].widget;
+
                 // Check if the mouse went down on the widget
-                if (m_Widgets[i]->m_MouseDown)
+                if (widget->m_MouseDown)
                 {
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if ((m_Widgets[i]->m_DraggableWidget) || (m_Widgets[i]->m_ContainerWidget))
+                    if ((widget->m_DraggableWidget) || (widget->m_ContainerWidget))
                     {
-                        m_Widgets[i]->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+                        widget->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
                         return true;
                     }
                 }
@@ -90,10 +107,10 @@ namespace tgui
                     if (widget->m_ContainerWidget)
                     {
                         // If another widget was focused then unfocus it now
-                        if ((m_FocusedWidget) && (m_Widgets[m_FocusedWidget-1] != widget))
+                        if ((m_FocusedWidget) && (m_Entries[m_FocusedWidget-1].widget != widget))
                         {
-                            m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                            m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+                            m_Entries[m_FocusedWidget-1].widget->m_Focused = false;
+                            m_Entries[m_FocusedWidget-1].widget->widgetUnfocused();
                             m_FocusedWidget = 0;
                         }
                     }
@@ -120,10 +137,15 @@ namespace tgui
                     widget->leftMouseReleased(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
 
                 // Tell all the other widgets that the mouse has gone up
-                for (std::vector<Widget::Ptr>::iterator it = m_Widgets.begin(); it != m_Widgets.end(); ++it)
+                for (std::vector<Entry>::iterator it = m_Entries.begin(); it != m_Entries.end(); ++it)
                 {
-                    if (*it != widget)
-                        (*it)->mouseNoLongerDown();
+                    if (it->widget != widget)
+                    {
+                        if (it->widget->m_MouseDown)
+                            it->widget->markDirty();
+
+                        it->widget->mouseNoLongerDown();
+                    }
                 }
 
                 if (widget != nullptr)
@@ -153,7 +175,7 @@ namespace tgui
                      || (event.key.code == sf::Keyboard::Return))
                     {
                         // Tell the widget that the key was pressed
-                        m_Widgets[m_FocusedWidget-1]->keyPressed(event.key.code);
+                        m_Entries[m_FocusedWidget-1].widget->keyPressed(event.key.code);
                     }
 
                     return true;
@@ -182,7 +204,7 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_FocusedWidget)
                 {
-                    m_Widgets[m_FocusedWidget-1]->textEntered(event.text.unicode);
+                    m_Entries[m_FocusedWidget-1].widget->textEntered(event.text.unicode);
                     return true;
                 }
             }
@@ -212,30 +234,25 @@ namespace tgui
 
     void EventManager::focusWidget(Widget *const widget)
     {
-        // Loop all the widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        // Search for the widget that has to be focused
+        unsigned int i = findEntry(widget);
+        if (i == NoEntry)
+            return;
+
+        // Only continue when the widget wasn't already focused
+        if (m_FocusedWidget != i+1)
         {
-            // Search for the widget that has to be focused
-            if (m_Widgets[i].get() == widget)
+            // Unfocus the currently focused widget
+            if (m_FocusedWidget)
             {
-                // Only continue when the widget wasn't already focused
-                if (m_FocusedWidget != i+1)
-                {
-                    // Unfocus the currently focused widget
-                    if (m_FocusedWidget)
-                    {
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                    }
-
-                    // Focus the new widget
-                    m_FocusedWidget = i+1;
-                    widget->m_Focused = true;
-                    widget->widgetFocused();
-                }
-
-                break;
+                m_Entries[m_FocusedWidget-1].widget->m_Focused = false;
+                m_Entries[m_FocusedWidget-1].widget->widgetUnfocused();
             }
+
+            // Focus the new widget
+            m_FocusedWidget = i+1;
+            widget->m_Focused = true;
+            widget->widgetFocused();
         }
     }
 
@@ -265,8 +282,8 @@ namespace tgui
     {
         if (m_FocusedWidget)
         {
-            m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-            m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+            m_Entries[m_FocusedWidget-1].widget->m_Focused = false;
+            m_Entries[m_FocusedWidget-1].widget->widgetUnfocused();
             m_FocusedWidget = 0;
         }
     }
@@ -275,17 +292,108 @@ namespace tgui
 
     void EventManager::updateTime(const sf::Time& elapsedTime)
     {
-        // Loop through all widgets
-        for (unsigned int i=0; i<m_Widgets.size(); ++i)
+        TGUI_PROFILE_ZONE("EventManager::updateTime");
+
+        m_Time += elapsedTime;
+        processTimers(m_Time);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::processTimers(const sf::Time& currentTime)
+    {
+        // Collect the widgets first, their update function may add new timers to the heap
+        std::vector<Widget::Ptr> expiredWidgets;
+        while (!m_Timers.empty() && (m_Timers.front().wakeUpTime <= currentTime))
         {
-            // Check if the widget is a container or an widget that uses the time
-            if (m_Widgets[i]->m_AnimatedWidget)
+            Timer timer = m_Timers.front();
+            std::pop_heap(m_Timers.begin(), m_Timers.end());
+            m_Timers.pop_back();
+
+            // Skip the timers that were replaced or cancelled
+            if (isTimerActive(timer.entry, timer.id))
             {
-                // Update the elapsed time
-                m_Widgets[i]->m_AnimationTimeElapsed += elapsedTime;
-                m_Widgets[i]->update();
+                m_Entries[timer.entry].timerId = 0;
+                expiredWidgets.push_back(m_Entries[timer.entry].widget);
             }
         }
+
+        for (std::vector<Widget::Ptr>::iterator it = expiredWidgets.begin(); it != expiredWidgets.end(); ++it)
+        {
+            // The widget may have been removed while updating another widget
+            unsigned int index = findEntry(it->get());
+            if (index == NoEntry)
+                continue;
+
+            Widget::Ptr& widget = *it;
+            widget->m_AnimationTimeElapsed += currentTime - m_Entries[index].scheduleTime;
+            widget->update();
+
+            // Widgets that don't schedule their own updates are updated every frame
+            if (widget->m_AnimatedWidget)
+                scheduleUpdate(widget.get(), currentTime, currentTime);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::rebaseTimers(const sf::Time& offset)
+    {
+        for (std::vector<Entry>::iterator it = m_Entries.begin(); it != m_Entries.end(); ++it)
+        {
+            it->scheduleTime += offset;
+            it->wakeUpTime += offset;
+        }
+
+        // All timers move by the same amount, so the heap remains valid
+        for (std::vector<Timer>::iterator it = m_Timers.begin(); it != m_Timers.end(); ++it)
+            it->wakeUpTime += offset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EventManager::scheduleUpdate(const Widget* widget, const sf::Time& currentTime, const sf::Time& wakeUpTime)
+    {
+        unsigned int index = findEntry(widget);
+        if (index == NoEntry)
+            return false;
+
+        // When the timer is replaced then the time since the original request still has to be given to the widget
+        if (m_Entries[index].timerId == 0)
+            m_Entries[index].scheduleTime = currentTime;
+
+        m_Entries[index].wakeUpTime = wakeUpTime;
+
+        // The new timer id makes the old timer of the widget invalid
+        pushTimer(index);
+        return m_Timers.front().id == m_Entries[index].timerId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::cancelScheduledUpdate(const Widget* widget)
+    {
+        unsigned int index = findEntry(widget);
+        if (index != NoEntry)
+            m_Entries[index].timerId = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EventManager::getNextWakeUpTime(sf::Time& wakeUpTime) const
+    {
+        // Don't wake up for a timer that no longer exists
+        while (!m_Timers.empty() && !isTimerActive(m_Timers.front().entry, m_Timers.front().id))
+        {
+            std::pop_heap(m_Timers.begin(), m_Timers.end());
+            m_Timers.pop_back();
+        }
+
+        if (m_Timers.empty())
+            return false;
+
+        wakeUpTime = m_Timers.front().wakeUpTime;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,34 +407,37 @@ namespace tgui
         // Check if a container is focused
         if (m_FocusedWidget)
         {
-            if (m_Widgets[m_FocusedWidget-1]->m_ContainerWidget)
+            if (m_Entries[m_FocusedWidget-1].widget->m_ContainerWidget)
             {
                 // Focus the next widget in container
-                if (static_cast<Container::Ptr>(m_Widgets[m_FocusedWidget-1])->focusNextWidgetInContainer())
+                if (static_cast<Container::Ptr>(m_Entries[m_FocusedWidget-1].widget)->focusNextWidgetInContainer())
                     return true;
             }
         }
 
         // Loop all widgets behind the focused one
-        for (unsigned int i=m_FocusedWidget; i<m_Widgets.size(); ++i)
+        unsigned int first = m_FocusedWidget ? m_Entries[m_FocusedWidget-1].above : m_Bottom;
+        for (unsigned int i = first; i != NoEntry; i = m_Entries[i].above)
         {
+            Widget::Ptr& widget = m_Entries[i].widget;
+
             // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
+            if (widget->m_AllowFocus == true)
             {
                 // Make sure that the widget is visible and enabled
-                if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
+                if ((m_Entries[i].visible) && (m_Entries[i].enabled))
                 {
                     if (m_FocusedWidget)
                     {
                         // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+                        m_Entries[m_FocusedWidget-1].widget->m_Focused = false;
+                        m_Entries[m_FocusedWidget-1].widget->widgetUnfocused();
                     }
 
                     // Focus on the new widget
                     m_FocusedWidget = i+1;
-                    m_Widgets[i]->m_Focused = true;
-                    m_Widgets[i]->widgetFocused();
+                    widget->m_Focused = true;
+                    widget->widgetFocused();
                     return true;
                 }
             }
@@ -335,22 +446,24 @@ namespace tgui
         // None of the widgets behind the focused one could be focused, so loop the ones before it
         if (m_FocusedWidget)
         {
-            for (unsigned int i=0; i<m_FocusedWidget-1; ++i)
+            for (unsigned int i = m_Bottom; i != m_FocusedWidget-1; i = m_Entries[i].above)
             {
+                Widget::Ptr& widget = m_Entries[i].widget;
+
                 // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i]->m_AllowFocus == true)
+                if (widget->m_AllowFocus == true)
                 {
                     // Make sure that the widget is visible and enabled
-                    if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
+                    if ((m_Entries[i].visible) && (m_Entries[i].enabled))
                     {
                         // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+                        m_Entries[m_FocusedWidget-1].widget->m_Focused = false;
+                        m_Entries[m_FocusedWidget-1].widget->widgetUnfocused();
 
                         // Focus on the new widget
                         m_FocusedWidget = i+1;
-                        m_Widgets[i]->m_Focused = true;
-                        m_Widgets[i]->widgetFocused();
+                        widget->m_Focused = true;
+                        widget->widgetFocused();
                         return true;
                     }
                 }
@@ -368,26 +481,29 @@ namespace tgui
         if (tabKeyUsageEnabled == false)
             return false;
 
-        // Loop through all widgets
-        for (unsigned int i=m_FocusedWidget; i<m_Widgets.size(); ++i)
+        // Loop through all widgets behind the focused one
+        unsigned int first = m_FocusedWidget ? m_Entries[m_FocusedWidget-1].above : m_Bottom;
+        for (unsigned int i = first; i != NoEntry; i = m_Entries[i].above)
         {
+            Widget::Ptr& widget = m_Entries[i].widget;
+
             // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
+            if (widget->m_AllowFocus == true)
             {
                 // Make sure that the widget is visible and enabled
-                if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
+                if ((m_Entries[i].visible) && (m_Entries[i].enabled))
                 {
                     if (m_FocusedWidget > 0)
                     {
                         // Unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+                        m_Entries[m_FocusedWidget-1].widget->m_Focused = false;
+                        m_Entries[m_FocusedWidget-1].widget->widgetUnfocused();
                     }
 
                     // Focus on the new widget
                     m_FocusedWidget = i+1;
-                    m_Widgets[i]->m_Focused = true;
-                    m_Widgets[i]->widgetFocused();
+                    widget->m_Focused = true;
+                    widget->widgetFocused();
 
                     return true;
                 }
@@ -406,23 +522,25 @@ namespace tgui
         bool widgetFound = false;
         Widget::Ptr widget = nullptr;
 
-        // Loop through all widgets
-        for (std::vector<Widget::Ptr>::reverse_iterator it = m_Widgets.rbegin(); it != m_Widgets.rend(); ++it)
+        // Loop through all widgets, starting with the one in front
+        for (unsigned int i = m_Top; i != NoEntry; i = m_Entries[i].below)
         {
+            Widget::Ptr& entryWidget = m_Entries[i].widget;
+
             // Check if the widget is visible and enabled
-            if (((*it)->m_Visible) && ((*it)->m_Enabled))
+            if ((m_Entries[i].visible) && (m_Entries[i].enabled))
             {
                 if (widgetFound == false)
                 {
                     // Return the widget if the mouse is on top of it
-                    if ((*it)->mouseOnWidget(x, y))
+                    if (entryWidget->mouseOnWidget(x, y))
                     {
-                        widget = *it;
+                        widget = entryWidget;
                         widgetFound = true;
                     }
                 }
                 else // The widget was already found, so tell the other widgets that the mouse can't be on them
-                    (*it)->mouseNotOnWidget();
+                    entryWidget->mouseNotOnWidget();
             }
         }
 
@@ -434,10 +552,10 @@ namespace tgui
     void EventManager::mouseNotOnWidget()
     {
         // Loop through all widgets
-        for (unsigned int i=0; i<m_Widgets.size(); ++i)
+        for (unsigned int i = 0; i < m_Entries.size(); ++i)
         {
             // Tell the widget that the mouse is no longer on top of it
-            m_Widgets[i]->mouseNotOnWidget();
+            m_Entries[i].widget->mouseNotOnWidget();
         }
     }
 
@@ -446,14 +564,465 @@ namespace tgui
     void EventManager::mouseNoLongerDown()
     {
         // Loop through all widgets
-        for (unsigned int i=0; i<m_Widgets.size(); ++i)
+        for (unsigned int i = 0; i < m_Entries.size(); ++i)
         {
             // Tell the widget that the mouse is no longer down
-            m_Widgets[i]->mouseNoLongerDown();
+            if (m_Entries[i].widget->m_MouseDown)
+                m_Entries[i].widget->markDirty();
+
+            m_Entries[i].widget->mouseNoLongerDown();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::addWidget(const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        m_Entries.push_back(Entry(widget, getNameId(widgetName)));
+
+        // Remember where the widget is stored, so that it can be found without searching
+        widget->m_EntryIndex = m_Entries.size() - 1;
+
+        // New widgets are always placed on top of the others
+        linkEntryOnTop(m_Entries.size() - 1);
+
+        m_OrderedListsNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EventManager::removeWidget(const Widget* widget)
+    {
+        unsigned int index = findEntry(widget);
+        if (index == NoEntry)
+            return false;
+
+        unlinkEntry(index);
+        releaseNameId(m_Entries[index].nameId);
+
+        // The widget can no longer be focused
+        if (m_FocusedWidget == index+1)
+            m_FocusedWidget = 0;
+
+        // Move the last entry in the place of the removed one
+        unsigned int last = m_Entries.size() - 1;
+        if (index != last)
+        {
+            Entry& moved = m_Entries[last];
+
+            if (moved.below != NoEntry)
+                m_Entries[moved.below].above = index;
+            else
+                m_Bottom = index;
+
+            if (moved.above != NoEntry)
+                m_Entries[moved.above].below = index;
+            else
+                m_Top = index;
+
+            if (m_FocusedWidget == last+1)
+                m_FocusedWidget = index+1;
+
+            moved.widget->m_EntryIndex = index;
+            std::swap(m_Entries[index], moved);
+
+            // The timer in the heap still refers to the old place of the entry
+            if (m_Entries[index].timerId)
+                pushTimer(index);
+        }
+
+        m_Entries.pop_back();
+
+        // Don't keep the removed widget alive in the ordered lists
+        m_OrderedWidgets.clear();
+        m_OrderedNames.clear();
+        m_OrderedListsNeedUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::removeAllWidgets()
+    {
+        m_Entries.clear();
+        m_Timers.clear();
+        m_Bottom = NoEntry;
+        m_Top = NoEntry;
+
+        // None of the names are used anymore
+        m_Names.assign(1, sf::String());
+        m_NameUsers.assign(1, 0);
+        m_FreeNameIds.clear();
+        m_NameIds.clear();
+
+        // There are no more widgets, so none of the widgets can be focused
+        m_FocusedWidget = 0;
+
+        m_OrderedWidgets.clear();
+        m_OrderedNames.clear();
+        m_OrderedListsNeedUpdate = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int EventManager::removeMarkedWidgets(const std::vector<bool>& marked)
+    {
+        std::vector<Entry> remainingEntries;
+        remainingEntries.reserve(m_Entries.size());
+
+        unsigned int focusedWidget = 0;
+        for (unsigned int i = m_Bottom; i != NoEntry; i = m_Entries[i].above)
+        {
+            if (marked[i])
+            {
+                releaseNameId(m_Entries[i].nameId);
+
+                // A removed widget can't stay focused
+                if (m_FocusedWidget == i+1)
+                {
+                    m_Entries[i].widget->m_Focused = false;
+                    m_Entries[i].widget->widgetUnfocused();
+                }
+            }
+            else
+            {
+                if (m_FocusedWidget == i+1)
+                    focusedWidget = remainingEntries.size() + 1;
+
+                remainingEntries.push_back(m_Entries[i]);
+            }
+        }
+
+        unsigned int removedWidgets = m_Entries.size() - remainingEntries.size();
+        if (removedWidgets == 0)
+            return 0;
+
+        // The remaining entries are already in the correct order, so the links just point to the neighbours
+        for (unsigned int i = 0; i < remainingEntries.size(); ++i)
+        {
+            remainingEntries[i].below = (i > 0) ? i-1 : NoEntry;
+            remainingEntries[i].above = (i+1 < remainingEntries.size()) ? i+1 : NoEntry;
+            remainingEntries[i].widget->m_EntryIndex = i;
+        }
+
+        m_Entries.swap(remainingEntries);
+        m_Bottom = m_Entries.empty() ? NoEntry : 0;
+        m_Top = m_Entries.empty() ? NoEntry : m_Entries.size() - 1;
+        m_FocusedWidget = focusedWidget;
+
+        // All entries have moved, so the heap is rebuilt with the remaining timers
+        m_Timers.clear();
+        for (unsigned int i = 0; i < m_Entries.size(); ++i)
+        {
+            if (m_Entries[i].timerId)
+            {
+                Timer timer;
+                timer.wakeUpTime = m_Entries[i].wakeUpTime;
+                timer.entry = i;
+                timer.id = m_Entries[i].timerId;
+                m_Timers.push_back(timer);
+            }
+        }
+        std::make_heap(m_Timers.begin(), m_Timers.end());
+
+        // Don't keep the removed widgets alive in the ordered lists
+        m_OrderedWidgets.clear();
+        m_OrderedNames.clear();
+        m_OrderedListsNeedUpdate = true;
+        return removedWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::reserve(unsigned int widgetCount)
+    {
+        m_Entries.reserve(widgetCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::moveWidgetToFront(const Widget* widget)
+    {
+        unsigned int index = findEntry(widget);
+        if ((index == NoEntry) || (index == m_Top))
+            return;
+
+        unlinkEntry(index);
+        linkEntryOnTop(index);
+
+        m_OrderedListsNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::moveWidgetToBack(const Widget* widget)
+    {
+        unsigned int index = findEntry(widget);
+        if ((index == NoEntry) || (index == m_Bottom))
+            return;
+
+        unlinkEntry(index);
+        linkEntryAtBottom(index);
+
+        m_OrderedListsNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Widget::Ptr>& EventManager::getWidgets() const
+    {
+        if (m_OrderedListsNeedUpdate)
+        {
+            m_OrderedWidgets.clear();
+            m_OrderedNames.clear();
+            m_OrderedWidgets.reserve(m_Entries.size());
+            m_OrderedNames.reserve(m_Entries.size());
+
+            for (unsigned int i = m_Bottom; i != NoEntry; i = m_Entries[i].above)
+            {
+                m_OrderedWidgets.push_back(m_Entries[i].widget);
+                m_OrderedNames.push_back(getName(m_Entries[i].nameId));
+            }
+
+            m_OrderedListsNeedUpdate = false;
+        }
+
+        return m_OrderedWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::String>& EventManager::getWidgetNames() const
+    {
+        // The names are rebuilt together with the widgets
+        getWidgets();
+        return m_OrderedNames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr EventManager::getWidget(const sf::String& widgetName) const
+    {
+        // A name that was never used can't belong to any widget
+        unsigned int nameId = findNameId(widgetName);
+        if (nameId == NoEntry)
+            return nullptr;
+
+        // When the name is used multiple times then the widget closest to the back is returned
+        for (unsigned int i = m_Bottom; i != NoEntry; i = m_Entries[i].above)
+        {
+            if (m_Entries[i].nameId == nameId)
+                return m_Entries[i].widget;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::updateWidgetState(const Widget* widget)
+    {
+        unsigned int index = findEntry(widget);
+        if (index == NoEntry)
+            return;
+
+        m_Entries[index].visible = widget->m_Visible;
+        m_Entries[index].enabled = widget->m_Enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::invalidateBounds(const Widget* widget)
+    {
+        unsigned int index = findEntry(widget);
+        if (index != NoEntry)
+            m_Entries[index].boundsChanged = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::updateCachedBounds() const
+    {
+        for (std::vector<Entry>::const_iterator it = m_Entries.begin(); it != m_Entries.end(); ++it)
+        {
+            // Hidden widgets keep their outdated bounds until they are shown again
+            if (it->visible && it->boundsChanged)
+            {
+                it->bounds = sf::FloatRect(it->widget->getPosition(), it->widget->getFullSize());
+                it->boundsChanged = false;
+            }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::pushTimer(unsigned int index)
+    {
+        // Timer id 0 is reserved for entries without timer
+        if (++m_LastTimerId == 0)
+            ++m_LastTimerId;
+
+        m_Entries[index].timerId = m_LastTimerId;
+
+        Timer timer;
+        timer.wakeUpTime = m_Entries[index].wakeUpTime;
+        timer.entry = index;
+        timer.id = m_LastTimerId;
+        m_Timers.push_back(timer);
+        std::push_heap(m_Timers.begin(), m_Timers.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EventManager::isTimerActive(unsigned int index, unsigned int timerId) const
+    {
+        return (index < m_Entries.size()) && (m_Entries[index].timerId == timerId);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int EventManager::findEntry(const Widget* widget) const
+    {
+        if (widget == nullptr)
+            return NoEntry;
+
+        // The widget remembers where it is stored, but the same widget could have been added to multiple containers
+        if ((widget->m_EntryIndex < m_Entries.size()) && (m_Entries[widget->m_EntryIndex].widget.get() == widget))
+            return widget->m_EntryIndex;
+
+        for (unsigned int i = 0; i < m_Entries.size(); ++i)
+        {
+            if (m_Entries[i].widget.get() == widget)
+                return i;
+        }
+
+        return NoEntry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::unlinkEntry(unsigned int index)
+    {
+        Entry& entry = m_Entries[index];
+
+        if (entry.below != NoEntry)
+            m_Entries[entry.below].above = entry.above;
+        else
+            m_Bottom = entry.above;
+
+        if (entry.above != NoEntry)
+            m_Entries[entry.above].below = entry.below;
+        else
+            m_Top = entry.below;
+
+        entry.below = NoEntry;
+        entry.above = NoEntry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::linkEntryOnTop(unsigned int index)
+    {
+        m_Entries[index].below = m_Top;
+        m_Entries[index].above = NoEntry;
+
+        if (m_Top != NoEntry)
+            m_Entries[m_Top].above = index;
+        else
+            m_Bottom = index;
+
+        m_Top = index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::linkEntryAtBottom(unsigned int index)
+    {
+        m_Entries[index].below = NoEntry;
+        m_Entries[index].above = m_Bottom;
+
+        if (m_Bottom != NoEntry)
+            m_Entries[m_Bottom].below = index;
+        else
+            m_Top = index;
+
+        m_Bottom = index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int EventManager::getNameId(const sf::String& name)
+    {
+        if (name.isEmpty())
+            return 0;
+
+        std::map<sf::String, unsigned int>::iterator it = m_NameIds.find(name);
+        if (it != m_NameIds.end())
+        {
+            ++m_NameUsers[it->second];
+            return it->second;
+        }
+
+        // Reuse the id of a name that is no longer used
+        unsigned int nameId;
+        if (!m_FreeNameIds.empty())
+        {
+            nameId = m_FreeNameIds.back();
+            m_FreeNameIds.pop_back();
+
+            m_Names[nameId] = name;
+            m_NameUsers[nameId] = 1;
+        }
+        else
+        {
+            nameId = m_Names.size();
+
+            m_Names.push_back(name);
+            m_NameUsers.push_back(1);
+        }
+
+        m_NameIds.insert(std::make_pair(name, nameId));
+        return nameId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventManager::releaseNameId(unsigned int nameId)
+    {
+        // The empty name is never removed
+        if (nameId == 0)
+            return;
+
+        if (--m_NameUsers[nameId] == 0)
+        {
+            m_NameIds.erase(m_Names[nameId]);
+            m_Names[nameId].clear();
+            m_FreeNameIds.push_back(nameId);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int EventManager::findNameId(const sf::String& name) const
+    {
+        if (name.isEmpty())
+            return 0;
+
+        std::map<sf::String, unsigned int>::const_iterator it = m_NameIds.find(name);
+        if (it != m_NameIds.end())
+            return it->second;
+        else
+            return NoEntry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String EventManager::getName(unsigned int nameId) const
+    {
+        return m_Names[nameId];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,348 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <map>
+#include <fstream>
+
+#include <TGUI/Profiler.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GlyphUsage::operator<(const GlyphUsage& right) const
+    {
+        if (font != right.font)
+            return font < right.font;
+        else if (characterSize != right.characterSize)
+            return characterSize < right.characterSize;
+        else if (bold != right.bold)
+            return bold < right.bold;
+        else
+            return character < right.character;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontManager::FontManager() :
+    m_GlyphTracking(false)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontData* FontManager::getFont(const std::string& filename)
+    {
+        TGUI_PROFILE_ZONE("FontManager::getFont");
+
+        // Loop all our fonts to check if we already have this one
+        for (std::list<FontData>::iterator it = m_Data.begin(); it != m_Data.end(); ++it)
+        {
+            if (it->filename == filename)
+            {
+                ++(it->users);
+                return &(*it);
+            }
+        }
+
+        // Add new data to the list
+        m_Data.push_back(FontData());
+        FontData& data = m_Data.back();
+
+        if (data.font.loadFromFile(filename))
+        {
+            data.filename = filename;
+            data.source = nullptr;
+            data.users = 1;
+            return &data;
+        }
+
+        // The font couldn't be loaded
+        m_Data.pop_back();
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontData* FontManager::copyFont(const sf::Font& font)
+    {
+        // Check if the font is one of ours or if it was already copied
+        for (std::list<FontData>::iterator it = m_Data.begin(); it != m_Data.end(); ++it)
+        {
+            if ((&it->font == &font) || (it->source == &font))
+            {
+                ++(it->users);
+                return &(*it);
+            }
+        }
+
+        // The font belongs to the user, so we need our own copy
+        m_Data.push_back(FontData());
+        FontData& data = m_Data.back();
+        data.font = font;
+        data.source = &font;
+        data.users = 1;
+        return &data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::addUser(FontData* font)
+    {
+        if (font)
+            ++(font->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::removeFont(FontData* fontToRemove)
+    {
+        if (fontToRemove == nullptr)
+            return;
+
+        // Loop all our fonts to check which one it is
+        for (std::list<FontData>::iterator it = m_Data.begin(); it != m_Data.end(); ++it)
+        {
+            if (&(*it) == fontToRemove)
+            {
+                // If this was the only place where the font is used then delete it
+                if (--(it->users) == 0)
+                {
+                    TGUI_TextMeasurementCache.removeFont(&it->font);
+
+                    std::set<std::pair<const sf::Font*, unsigned int>>::iterator sizeIt = m_UsedCharacterSizes.lower_bound(std::make_pair(&it->font, 0u));
+                    while ((sizeIt != m_UsedCharacterSizes.end()) && (sizeIt->first == &it->font))
+                        m_UsedCharacterSizes.erase(sizeIt++);
+
+                    m_Data.erase(it);
+                }
+
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::list<FontData>& FontManager::getFontData() const
+    {
+        return m_Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::prewarm(const sf::Font& font, const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold)
+    {
+        TGUI_PROFILE_ZONE("FontManager::prewarm");
+
+        GlyphUsage glyph;
+        glyph.font = &font;
+        glyph.bold = bold;
+
+        for (std::vector<unsigned int>::const_iterator sizeIt = characterSizes.begin(); sizeIt != characterSizes.end(); ++sizeIt)
+        {
+            glyph.characterSize = *sizeIt;
+            for (std::size_t i = 0; i < characters.getSize(); ++i)
+            {
+                // Asking for the glyph is enough to render it into the glyph cache
+                font.getGlyph(characters[i], *sizeIt, bold);
+
+                if (m_GlyphTracking)
+                {
+                    glyph.character = characters[i];
+                    m_KnownGlyphs.insert(glyph);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FontManager::prewarmFromFile(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str());
+        if (!file.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open the glyph list " << filename << ".");
+            return false;
+        }
+
+        // Every font starts with its filename between brackets, followed by a line per character size with the character size,
+        // whether the glyphs are bold and the unicode values of the characters
+        const sf::Font* font = nullptr;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (line.empty())
+                continue;
+
+            if (line[0] == '[')
+            {
+                font = nullptr;
+
+                const std::string fontFilename = line.substr(1, line.find_last_of(']') - 1);
+                for (std::list<FontData>::iterator it = m_Data.begin(); it != m_Data.end(); ++it)
+                {
+                    if (it->filename == fontFilename)
+                    {
+                        font = &it->font;
+                        break;
+                    }
+                }
+            }
+            else if (font)
+            {
+                std::istringstream stream(line);
+
+                unsigned int characterSize;
+                bool bold;
+                if (!(stream >> characterSize >> bold))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to read the glyph list " << filename << ".");
+                    return false;
+                }
+
+                sf::String characters;
+                sf::Uint32 character;
+                while (stream >> character)
+                    characters += character;
+
+                prewarm(*font, characters, std::vector<unsigned int>(1, characterSize), bold);
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::enableGlyphTracking(bool enabled)
+    {
+        m_GlyphTracking = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<GlyphUsage>& FontManager::getOnDemandGlyphs() const
+    {
+        return m_OnDemandGlyphs;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FontManager::saveGlyphList(const std::string& filename) const
+    {
+        // Group the characters per font, character size and style
+        std::map<std::string, std::map<std::pair<unsigned int, bool>, std::vector<sf::Uint32> > > fonts;
+        for (std::vector<GlyphUsage>::const_iterator glyphIt = m_OnDemandGlyphs.begin(); glyphIt != m_OnDemandGlyphs.end(); ++glyphIt)
+        {
+            for (std::list<FontData>::const_iterator it = m_Data.begin(); it != m_Data.end(); ++it)
+            {
+                if ((&it->font == glyphIt->font) && !it->filename.empty())
+                {
+                    fonts[it->filename][std::make_pair(glyphIt->characterSize, glyphIt->bold)].push_back(glyphIt->character);
+                    break;
+                }
+            }
+        }
+
+        std::ofstream file(filename.c_str());
+        if (!file.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to create the glyph list " << filename << ".");
+            return false;
+        }
+
+        for (std::map<std::string, std::map<std::pair<unsigned int, bool>, std::vector<sf::Uint32> > >::const_iterator fontIt = fonts.begin(); fontIt != fonts.end(); ++fontIt)
+        {
+            file << "[" << fontIt->first << "]\n";
+
+            for (std::map<std::pair<unsigned int, bool>, std::vector<sf::Uint32> >::const_iterator sizeIt = fontIt->second.begin(); sizeIt != fontIt->second.end(); ++sizeIt)
+            {
+                file << sizeIt->first.first << " " << sizeIt->first.second;
+                for (std::vector<sf::Uint32>::const_iterator it = sizeIt->second.begin(); it != sizeIt->second.end(); ++it)
+                    file << " " << *it;
+
+                file << "\n";
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::trackText(const sf::Text& text)
+    {
+        trackString(text.getFont(), text.getCharacterSize(), (text.getStyle() & sf::Text::Bold) != 0, text.getString());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::trackString(const sf::Font* font, unsigned int characterSize, bool bold, const sf::String& string)
+    {
+        if ((font == nullptr) || string.isEmpty())
+            return;
+
+        m_UsedCharacterSizes.insert(std::make_pair(font, characterSize));
+
+        if (!m_GlyphTracking)
+            return;
+
+        GlyphUsage glyph;
+        glyph.font = font;
+        glyph.characterSize = characterSize;
+        glyph.bold = bold;
+
+        // SFML always loads the glyph of a space to know the width of whitespace
+        glyph.character = L' ';
+        if (m_KnownGlyphs.insert(glyph).second)
+            m_OnDemandGlyphs.push_back(glyph);
+
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            // SFML uses the glyph of a space for all whitespace
+            glyph.character = string[i];
+            if ((glyph.character == L'\t') || (glyph.character == L'\n') || (glyph.character == L'\v'))
+                glyph.character = L' ';
+
+            if (m_KnownGlyphs.insert(glyph).second)
+                m_OnDemandGlyphs.push_back(glyph);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FontManager::isCharacterSizeUsed(const sf::Font* font, unsigned int characterSize) const
+    {
+        return m_UsedCharacterSizes.find(std::make_pair(font, characterSize)) != m_UsedCharacterSizes.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Grid.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,7 +48,7 @@ namespace tgui
     m_Size        (gridToCopy.m_Size),
     m_IntendedSize(gridToCopy.m_IntendedSize)
     {
-        const std::vector<Widget::Ptr>& widgets = gridToCopy.m_EventManager.m_Widgets;
+        const std::vector<Widget::Ptr>& widgets = gridToCopy.getWidgets();
 
         for (unsigned int row = 0; row < gridToCopy.m_GridWidgets.size(); ++row)
         {
@@ -103,6 +104,8 @@ namespace tgui
 
     void Grid::setSize(float width, float height)
     {
+        markDirty();
+
         // A negative size is not allowed for this object
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -200,6 +203,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int Grid::removeMarkedWidgets(const std::vector<bool>& marked)
+    {
+        unsigned int columns = 0;
+        unsigned int newRow = 0;
+        for (unsigned int row = 0; row < m_GridWidgets.size(); ++row)
+        {
+            // The removed widgets leave an empty cell behind, so that the other widgets stay in their column
+            bool widgetRemoved = false;
+            for (unsigned int col = 0; col < m_GridWidgets[row].size(); ++col)
+            {
+                // Skip the empty cells
+                if (m_GridWidgets[row][col].get() == nullptr)
+                    continue;
+
+                unsigned int index = m_EventManager.findEntry(m_GridWidgets[row][col].get());
+                if ((index != EventManager::NoEntry) && marked[index])
+                {
+                    m_GridWidgets[row][col] = nullptr;
+                    widgetRemoved = true;
+                }
+            }
+
+            // The empty cells at the end of the row are no longer needed
+            unsigned int newCol = m_GridWidgets[row].size();
+            while ((newCol > 0) && (m_GridWidgets[row][newCol-1].get() == nullptr))
+                --newCol;
+
+            m_GridWidgets[row].erase(m_GridWidgets[row].begin() + newCol, m_GridWidgets[row].end());
+            m_ObjBorders[row].resize(newCol);
+            m_ObjLayout[row].resize(newCol);
+
+            // Rows that became empty are removed as well
+            if ((newCol > 0) || !widgetRemoved)
+            {
+                if (newRow != row)
+                {
+                    m_GridWidgets[newRow].swap(m_GridWidgets[row]);
+                    m_ObjBorders[newRow].swap(m_ObjBorders[row]);
+                    m_ObjLayout[newRow].swap(m_ObjLayout[row]);
+                    m_RowHeight[newRow] = m_RowHeight[row];
+                }
+
+                if (columns < newCol)
+                    columns = newCol;
+                ++newRow;
+            }
+        }
+
+        m_GridWidgets.resize(newRow);
+        m_ObjBorders.resize(newRow);
+        m_ObjLayout.resize(newRow);
+        m_RowHeight.resize(newRow);
+
+        // Erase the columns that are no longer used by any row
+        if (m_ColumnWidth.size() > columns)
+            m_ColumnWidth.resize(columns);
+
+        unsigned int removedWidgets = Container::removeMarkedWidgets(marked);
+
+        updatePositionsOfAllWidgets();
+        return removedWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::addWidget(const Widget::Ptr& widget, unsigned int row, unsigned int col,
                          const Borders& borders, Layout::Layouts layout)
     {
@@ -283,6 +351,8 @@ namespace tgui
 
     void Grid::changeWidgetBorders(const Widget::Ptr& widget, const Borders& borders)
     {
+        markDirty();
+
         // Find the widget in the grid
         for (unsigned int row=0; row < m_GridWidgets.size(); ++row)
         {
@@ -304,6 +374,8 @@ namespace tgui
 
     void Grid::changeWidgetLayout(const Widget::Ptr& widget, Layout::Layouts layout)
     {
+        markDirty();
+
         // Find the widget in the grid
         for (unsigned int row=0; row < m_GridWidgets.size(); ++row)
         {
@@ -553,6 +625,15 @@ namespace tgui
 
     void Grid::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Grid::draw");
+
+        // Draw the cached texture instead when caching is enabled
+        if (drawCache(target, states, getSize()))
+            return;
+
+        // Draw the widgets with the transparency of the grid
+        float oldOpacity = applyOpacity(target, states);
+
         // Set the transformation
         states.transform *= getTransform();
 
@@ -565,6 +646,8 @@ namespace tgui
                     target.draw(*m_GridWidgets[row][col], states);
             }
         }
+
+        restoreOpacity(oldOpacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
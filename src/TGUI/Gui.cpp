@@ -25,8 +25,45 @@
 
 #include <SFML/OpenGL.hpp>
 
+#include <limits>
+
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Gui.hpp>
+#include <TGUI/Profiler.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Merges the areas that overlap, so that no part of the window is redrawn more than once
+    void mergeOverlappingAreas(std::vector<sf::FloatRect>& areas)
+    {
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (unsigned int i = 0; i < areas.size(); ++i)
+            {
+                for (unsigned int j = i + 1; j < areas.size(); ++j)
+                {
+                    if (areas[i].intersects(areas[j]))
+                    {
+                        float left = TGUI_MINIMUM(areas[i].left, areas[j].left);
+                        float top = TGUI_MINIMUM(areas[i].top, areas[j].top);
+                        float right = TGUI_MAXIMUM(areas[i].left + areas[i].width, areas[j].left + areas[j].width);
+                        float bottom = TGUI_MAXIMUM(areas[i].top + areas[i].height, areas[j].top + areas[j].height);
+                        areas[i] = sf::FloatRect(left, top, right - left, bottom - top);
+
+                        // The last area takes the place of the one that was merged
+                        areas[j--] = areas.back();
+                        areas.pop_back();
+                        merged = true;
+                    }
+                }
+            }
+        }
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,7 +72,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
-    m_Window(nullptr)
+    m_Clock             (&m_SystemClock),
+    m_Target            (nullptr),
+    m_PartialRedraw     (false),
+    m_ShowDamagedAreas  (false),
+    m_RenderStatsEnabled(false),
+    m_ShowRenderStats   (false)
     {
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
 
@@ -45,10 +87,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Gui::Gui(sf::RenderWindow& window) :
-    m_Window(&window)
+    Gui::Gui(sf::RenderTarget& target) :
+    m_Clock             (&m_SystemClock),
+    m_Target            (&target),
+    m_PartialRedraw     (false),
+    m_ShowDamagedAreas  (false),
+    m_RenderStatsEnabled(false),
+    m_ShowRenderStats   (false)
     {
-        m_Container.m_Window = &window;
+        m_Container.m_Target = &target;
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
 
         // The main window is always focused
@@ -59,25 +106,48 @@ namespace tgui
 
     void Gui::setWindow(sf::RenderWindow& window)
     {
-        m_Window = &window;
-        m_Container.m_Window = &window;
+        setTarget(window);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::RenderWindow* Gui::getWindow()
     {
-        return m_Window;
+        return dynamic_cast<sf::RenderWindow*>(m_Target);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setTarget(sf::RenderTarget& target)
+    {
+        m_Target = &target;
+        m_Container.m_Target = &target;
+
+        // Everything has to be drawn on the new target
+        m_Container.markDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::RenderTarget* Gui::getTarget()
+    {
+        return m_Target;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Gui::handleEvent(sf::Event event)
     {
+        TGUI_PROFILE_ZONE("Gui::handleEvent");
+
+        // The event is recorded before the mouse position is changed, the replay will pass it to this function again
+        if (m_Recorder.isOpen())
+            m_Recorder.addEvent(event);
+
         // Check if the event has something to do with the mouse
         if (event.type == sf::Event::MouseMoved)
         {
-            sf::Vector2f mouseCoords = m_Window->mapPixelToCoords(sf::Vector2i(event.mouseMove.x, event.mouseMove.y), m_Window->getView());
+            sf::Vector2f mouseCoords = m_Target->mapPixelToCoords(sf::Vector2i(event.mouseMove.x, event.mouseMove.y), m_Target->getView());
 
             // Adjust the mouse position of the event
             event.mouseMove.x = static_cast<int>(mouseCoords.x + 0.5f);
@@ -85,7 +155,7 @@ namespace tgui
         }
         else if ((event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::MouseButtonReleased))
         {
-            sf::Vector2f mouseCoords = m_Window->mapPixelToCoords(sf::Vector2i(event.mouseButton.x, event.mouseButton.y), m_Window->getView());
+            sf::Vector2f mouseCoords = m_Target->mapPixelToCoords(sf::Vector2i(event.mouseButton.x, event.mouseButton.y), m_Target->getView());
 
             // Adjust the mouse position of the event
             event.mouseButton.x = static_cast<int>(mouseCoords.x + 0.5f);
@@ -93,23 +163,90 @@ namespace tgui
         }
         else if (event.type == sf::Event::MouseWheelMoved)
         {
-            sf::Vector2f mouseCoords = m_Window->mapPixelToCoords(sf::Vector2i(event.mouseWheel.x, event.mouseWheel.y), m_Window->getView());
+            sf::Vector2f mouseCoords = m_Target->mapPixelToCoords(sf::Vector2i(event.mouseWheel.x, event.mouseWheel.y), m_Target->getView());
 
             // Adjust the mouse position of the event
             event.mouseWheel.x = static_cast<int>(mouseCoords.x + 0.5f);
             event.mouseWheel.y = static_cast<int>(mouseCoords.y + 0.5f);
         }
+        else if ((event.type == sf::Event::Resized) || (event.type == sf::Event::GainedFocus))
+        {
+            // The contents of the window have to be drawn again
+            m_Container.markDirty();
+        }
 
         // Let the event manager handle the event
-        return m_Container.m_EventManager.handleEvent(event);
+        if (m_RenderStatsEnabled)
+        {
+            sf::Clock clock;
+            TGUI_RenderStats = &m_RenderStats;
+
+            const bool handled = m_Container.m_EventManager.handleEvent(event);
+
+            TGUI_RenderStats = nullptr;
+            m_RenderStats.handleEventTime += clock.getElapsedTime();
+            return handled;
+        }
+        else
+            return m_Container.m_EventManager.handleEvent(event);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Gui::draw()
     {
-        // Update the time
-        updateTime(m_Clock.restart());
+        TGUI_PROFILE_ZONE("Gui::draw");
+
+        // Update the time, unless the application updates the widgets itself with a fixed time step
+        if (m_FixedTimeStep == sf::Time::Zero)
+        {
+            const sf::Time elapsedTime = m_Clock->restart();
+            if (m_Recorder.isOpen())
+                m_Recorder.addFrame(elapsedTime);
+
+            updateWidgets(elapsedTime);
+        }
+        else if (m_Recorder.isOpen())
+            m_Recorder.addFrame(sf::Time::Zero);
+
+        if (m_RenderStatsEnabled)
+        {
+            sf::Clock clock;
+            TGUI_RenderStats = &m_RenderStats;
+
+            drawWidgets();
+
+            TGUI_RenderStats = nullptr;
+            m_RenderStats.drawTime = clock.getElapsedTime();
+
+            // The statistics of this frame are complete now
+            m_LastFrameStats = m_RenderStats;
+            m_RenderStats.reset();
+
+            // The overlay is drawn on top of everything and is not included in the statistics
+            if (m_ShowRenderStats)
+            {
+                m_RenderStatsOverlay.setTextFont(m_Container.getGlobalFont());
+                m_RenderStatsOverlay.setStats(m_LastFrameStats);
+                m_Target->draw(m_RenderStatsOverlay);
+            }
+        }
+        else
+            drawWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets()
+    {
+        if (m_PartialRedraw)
+        {
+            drawDamagedAreas();
+            m_Container.clearDirtyFlags();
+            return;
+        }
+
+        activateTarget();
 
         // Check if clipping is enabled
         GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
@@ -124,17 +261,119 @@ namespace tgui
         {
             // Enable clipping
             glEnable(GL_SCISSOR_TEST);
-            glScissor(0, 0, m_Window->getSize().x, m_Window->getSize().y);
+            setScissor(0, 0, m_Target->getSize().x, m_Target->getSize().y);
         }
 
         // Draw the window with all widgets inside it
-        m_Container.drawWidgetContainer(m_Window, sf::RenderStates::Default);
+        m_Container.drawWidgetContainer(m_Target, sf::RenderStates::Default);
 
         // Reset clipping to its original state
         if (clippingEnabled)
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
         else
             glDisable(GL_SCISSOR_TEST);
+
+        // Everything that was changed has been drawn now
+        m_Container.clearDirtyFlags();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::activateTarget()
+    {
+        // A render texture has its own context, which makes it possible to draw the gui without a window
+        if (sf::RenderWindow* window = dynamic_cast<sf::RenderWindow*>(m_Target))
+            window->setActive(true);
+        else if (sf::RenderTexture* texture = dynamic_cast<sf::RenderTexture*>(m_Target))
+            texture->setActive(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::enablePartialRedraw(bool enabled, const sf::Color& background)
+    {
+        m_PartialRedraw = enabled;
+
+        // The background has to be opaque, otherwise the widgets would be blended again when the texture is drawn
+        m_PartialRedrawBackground = sf::Color(background.r, background.g, background.b);
+
+        // Everything will have to be drawn when partial redrawing is enabled again
+        m_Container.markDirty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isPartialRedrawEnabled() const
+    {
+        return m_PartialRedraw;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::showDamagedAreas(bool show)
+    {
+        m_ShowDamagedAreas = show;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getCulledWidgetCount() const
+    {
+        return m_Container.getCulledWidgetCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::enableRenderStats(bool enabled)
+    {
+        m_RenderStatsEnabled = enabled;
+        m_RenderStats.reset();
+        m_LastFrameStats.reset();
+
+        // The statistics can't be shown when they aren't collected
+        if (!enabled)
+            m_ShowRenderStats = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RenderStats& Gui::getRenderStats() const
+    {
+        return m_LastFrameStats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::showRenderStats(bool show)
+    {
+        if (show && !m_RenderStatsEnabled)
+            enableRenderStats(true);
+
+        m_ShowRenderStats = show;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryStats Gui::getMemoryStats() const
+    {
+        MemoryStats stats;
+        stats.collect(m_Container);
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        // The statistics change every frame
+        if (m_ShowRenderStats)
+            return true;
+
+        if (m_Container.isDirty())
+            return true;
+
+        // The widgets that are waiting for an update will probably change
+        return getTimeUntilNextUpdate() == sf::Time();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,7 +399,7 @@ namespace tgui
 
     sf::Vector2f Gui::getSize() const
     {
-        return sf::Vector2f(m_Window->getSize());
+        return sf::Vector2f(m_Target->getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,14 +425,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector< Widget::Ptr >& Gui::getWidgets()
+    void Gui::prewarmGlyphs(const sf::String& characters, const std::vector<unsigned int>& characterSizes)
+    {
+        TGUI_FontManager.prewarm(m_Container.getGlobalFont(), characters, characterSizes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector< Widget::Ptr >& Gui::getWidgets() const
     {
         return m_Container.getWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<sf::String>& Gui::getWidgetNames()
+    const std::vector<sf::String>& Gui::getWidgetNames() const
     {
         return m_Container.getWidgetNames();
     }
@@ -235,6 +481,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::addRange(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        m_Container.addRange(widgets, widgetNames);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::removeIf(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        return m_Container.removeIf(predicate);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::removeRange(const std::vector<Widget::Ptr>& widgets)
+    {
+        m_Container.removeRange(widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::reserve(unsigned int widgetCount)
+    {
+        m_Container.reserve(widgetCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::focusWidget(Widget::Ptr& widget)
     {
         m_Container.focusWidget(&*widget);
@@ -293,6 +567,8 @@ namespace tgui
 
     bool Gui::loadWidgetsFromFile(const std::string& filename)
     {
+        TGUI_PROFILE_ZONE("Gui::loadWidgetsFromFile");
+
         return m_Container.loadWidgetsFromFile(filename);
     }
 
@@ -300,7 +576,126 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
-        m_Container.m_EventManager.updateTime(elapsedTime);
+        if (m_Recorder.isOpen())
+            m_Recorder.addUpdate(elapsedTime);
+
+        updateWidgets(elapsedTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::update()
+    {
+        if (m_FixedTimeStep == sf::Time::Zero)
+        {
+            updateTime(m_Clock->restart());
+            return 1;
+        }
+
+        m_AccumulatedTime += m_Clock->restart();
+
+        // When the application couldn't keep up (e.g. because it was paused in a debugger) then the time that can't be
+        // processed is dropped, otherwise the updates could take so long that the application never catches up again
+        const unsigned int maxSteps = 10;
+        if (m_AccumulatedTime > m_FixedTimeStep * static_cast<float>(maxSteps))
+            m_AccumulatedTime = m_FixedTimeStep * static_cast<float>(maxSteps);
+
+        unsigned int steps = 0;
+        while (m_AccumulatedTime >= m_FixedTimeStep)
+        {
+            updateTime(m_FixedTimeStep);
+            m_AccumulatedTime -= m_FixedTimeStep;
+            ++steps;
+        }
+
+        return steps;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setFixedTimeStep(const sf::Time& timeStep)
+    {
+        // A negative time step would make the update function loop forever, so it disables the fixed time step as well
+        if (timeStep > sf::Time::Zero)
+            m_FixedTimeStep = timeStep;
+        else
+            m_FixedTimeStep = sf::Time::Zero;
+
+        m_AccumulatedTime = sf::Time::Zero;
+
+        // The time before the mode was changed doesn't count
+        m_Clock->restart();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getFixedTimeStep() const
+    {
+        return m_FixedTimeStep;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateWidgets(const sf::Time& elapsedTime)
+    {
+        TGUI_PROFILE_ZONE("Gui::updateTime");
+
+        if (m_RenderStatsEnabled)
+        {
+            sf::Clock clock;
+            TGUI_RenderStats = &m_RenderStats;
+
+            m_Container.m_EventManager.updateTime(elapsedTime);
+
+            TGUI_RenderStats = nullptr;
+            m_RenderStats.updateTime += clock.getElapsedTime();
+        }
+        else
+            m_Container.m_EventManager.updateTime(elapsedTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTimeUntilNextUpdate() const
+    {
+        sf::Time wakeUpTime;
+        if (!m_Container.m_EventManager.getNextWakeUpTime(wakeUpTime))
+            return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        // The clock keeps running since the last update
+        sf::Time timeLeft = wakeUpTime - m_Container.m_EventManager.m_Time - m_AccumulatedTime - m_Clock->getElapsedTime();
+        if (timeLeft > sf::Time())
+            return timeLeft;
+        else
+            return sf::Time();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setClock(Clock* clock)
+    {
+        if (clock)
+            m_Clock = clock;
+        else
+            m_Clock = &m_SystemClock;
+
+        // The time before the clock was set doesn't count
+        m_Clock->restart();
+        m_AccumulatedTime = sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::startRecording(const std::string& filename)
+    {
+        return m_Recorder.open(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::stopRecording()
+    {
+        m_Recorder.close();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,6 +707,111 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawDamagedAreas()
+    {
+        bool redrawEverything = m_Container.m_Changed;
+
+        // The texture has the same size as the target
+        sf::Vector2u size = m_Target->getSize();
+        if ((m_RenderTexture.getSize().x != size.x) || (m_RenderTexture.getSize().y != size.y))
+        {
+            if (!m_RenderTexture.create(size.x, size.y))
+            {
+                TGUI_OUTPUT("TGUI error: Failed to create the texture for partial redrawing.");
+                return;
+            }
+
+            redrawEverything = true;
+        }
+
+        // Everything moves when the view is changed
+        const sf::View view = m_Target->getView();
+        const sf::View& oldView = m_RenderTexture.getView();
+        if ((view.getCenter() != oldView.getCenter()) || (view.getSize() != oldView.getSize())
+         || (view.getRotation() != oldView.getRotation()) || (view.getViewport() != oldView.getViewport()))
+        {
+            m_RenderTexture.setView(view);
+            redrawEverything = true;
+        }
+
+        m_DamagedAreas.clear();
+        if (redrawEverything)
+            m_DamagedAreas.push_back(sf::FloatRect(view.getCenter() - (view.getSize() / 2.f), view.getSize()));
+        else
+        {
+            m_Container.collectDamagedAreas(m_DamagedAreas, sf::Vector2f(0, 0));
+            mergeOverlappingAreas(m_DamagedAreas);
+        }
+
+        m_RenderTexture.setActive(true);
+        glEnable(GL_SCISSOR_TEST);
+
+        // Only the containers that are redrawn will count their skipped widgets
+        unsigned int culledWidgets = 0;
+
+        if (redrawEverything)
+        {
+            setScissor(0, 0, size.x, size.y);
+            m_RenderTexture.clear(m_PartialRedrawBackground);
+            m_Container.drawWidgetContainer(&m_RenderTexture, sf::RenderStates::Default);
+            culledWidgets = m_Container.m_CulledWidgetCount;
+        }
+        else
+        {
+            for (std::vector<sf::FloatRect>::const_iterator area = m_DamagedAreas.begin(); area != m_DamagedAreas.end(); ++area)
+            {
+                // Calculate the clipping area, with an extra pixel on each side to cover rounding
+                sf::Vector2i topLeft = m_RenderTexture.mapCoordsToPixel(sf::Vector2f(area->left, area->top));
+                sf::Vector2i bottomRight = m_RenderTexture.mapCoordsToPixel(sf::Vector2f(area->left + area->width, area->top + area->height));
+
+                GLint left = TGUI_MAXIMUM(topLeft.x - 1, 0);
+                GLint top = TGUI_MAXIMUM(topLeft.y - 1, 0);
+                GLint right = TGUI_MINIMUM(bottomRight.x + 1, static_cast<GLint>(size.x));
+                GLint bottom = TGUI_MINIMUM(bottomRight.y + 1, static_cast<GLint>(size.y));
+
+                // Skip the area when it lies outside the window
+                if ((right <= left) || (bottom <= top))
+                    continue;
+
+                // Erase the old contents of the area, clearing is limited to the clipping area
+                setScissor(left, size.y - bottom, right - left, bottom - top);
+                m_RenderTexture.clear(m_PartialRedrawBackground);
+
+                // Redraw the widgets, the ones outside the clipping area are skipped like in a full redraw
+                m_Container.drawWidgetContainer(&m_RenderTexture, sf::RenderStates::Default);
+                culledWidgets += m_Container.m_CulledWidgetCount;
+            }
+        }
+
+        m_Container.m_CulledWidgetCount = culledWidgets;
+
+        m_RenderTexture.display();
+
+        // The context of the render texture is still active, but the result has to end up on the target
+        activateTarget();
+
+        // The texture has the size of the target, so it is drawn without the view.
+        // It already contains the blended widgets, so it replaces the pixels instead of being blended a second time.
+        m_Target->setView(m_Target->getDefaultView());
+        m_Target->draw(sf::Sprite(m_RenderTexture.getTexture()), sf::RenderStates(sf::BlendNone));
+        m_Target->setView(view);
+
+        if (m_ShowDamagedAreas)
+        {
+            for (std::vector<sf::FloatRect>::const_iterator area = m_DamagedAreas.begin(); area != m_DamagedAreas.end(); ++area)
+            {
+                sf::RectangleShape rect(sf::Vector2f(area->width, area->height));
+                rect.setPosition(area->left, area->top);
+                rect.setFillColor(sf::Color(255, 0, 0, 60));
+                rect.setOutlineColor(sf::Color::Red);
+                rect.setOutlineThickness(-1);
+                m_Target->draw(rect);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
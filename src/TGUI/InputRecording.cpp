@@ -0,0 +1,340 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TGUI.hpp>
+#include <TGUI/InputRecording.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Every recording starts with this text, the last character is the version of the file format
+    const char fileHeader[8] = {'T', 'G', 'U', 'I', 'R', 'E', 'C', '1'};
+
+    enum RecordType
+    {
+        Record_Event = 1,
+        Record_Update,
+        Record_Frame
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The numbers are always stored in little endian, so that a recording can be replayed on any machine
+    void writeInt(std::ostream& stream, sf::Int64 value, unsigned int bytes)
+    {
+        for (unsigned int i = 0; i < bytes; ++i)
+            stream.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Int64 readInt(std::istream& stream, unsigned int bytes)
+    {
+        sf::Uint64 value = 0;
+        for (unsigned int i = 0; i < bytes; ++i)
+            value |= static_cast<sf::Uint64>(static_cast<unsigned char>(stream.get())) << (i * 8);
+
+        // Restore the sign of numbers that are smaller than 64 bit
+        if ((bytes < 8) && (value & (static_cast<sf::Uint64>(1) << (bytes * 8 - 1))))
+            value |= ~static_cast<sf::Uint64>(0) << (bytes * 8);
+
+        return static_cast<sf::Int64>(value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputRecorder::open(const std::string& filename)
+    {
+        close();
+
+        m_File.open(filename.c_str(), std::ios::binary);
+        if (!m_File.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to create the recording " << filename << ".");
+            return false;
+        }
+
+        m_File.write(fileHeader, sizeof(fileHeader));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void InputRecorder::close()
+    {
+        if (m_File.is_open())
+            m_File.close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputRecorder::isOpen() const
+    {
+        return m_File.is_open();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void InputRecorder::addEvent(const sf::Event& event)
+    {
+        if ((event.type == sf::Event::JoystickButtonPressed) || (event.type == sf::Event::JoystickButtonReleased)
+         || (event.type == sf::Event::JoystickMoved) || (event.type == sf::Event::JoystickConnected)
+         || (event.type == sf::Event::JoystickDisconnected))
+            return;
+
+        writeInt(m_File, Record_Event, 1);
+        writeInt(m_File, event.type, 1);
+
+        // Only the members that belong to the type of the event are stored
+        switch (event.type)
+        {
+            case sf::Event::Resized:
+                writeInt(m_File, event.size.width, 4);
+                writeInt(m_File, event.size.height, 4);
+                break;
+
+            case sf::Event::TextEntered:
+                writeInt(m_File, event.text.unicode, 4);
+                break;
+
+            case sf::Event::KeyPressed:
+            case sf::Event::KeyReleased:
+                writeInt(m_File, event.key.code, 4);
+                writeInt(m_File, (event.key.alt ? 1 : 0) | (event.key.control ? 2 : 0) | (event.key.shift ? 4 : 0) | (event.key.system ? 8 : 0), 1);
+                break;
+
+            case sf::Event::MouseWheelMoved:
+                writeInt(m_File, event.mouseWheel.delta, 4);
+                writeInt(m_File, event.mouseWheel.x, 4);
+                writeInt(m_File, event.mouseWheel.y, 4);
+                break;
+
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+                writeInt(m_File, event.mouseButton.button, 1);
+                writeInt(m_File, event.mouseButton.x, 4);
+                writeInt(m_File, event.mouseButton.y, 4);
+                break;
+
+            case sf::Event::MouseMoved:
+                writeInt(m_File, event.mouseMove.x, 4);
+                writeInt(m_File, event.mouseMove.y, 4);
+                break;
+
+            default: // The other events have no members
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void InputRecorder::addUpdate(const sf::Time& elapsedTime)
+    {
+        writeInt(m_File, Record_Update, 1);
+        writeInt(m_File, elapsedTime.asMicroseconds(), 8);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void InputRecorder::addFrame(const sf::Time& elapsedTime)
+    {
+        writeInt(m_File, Record_Frame, 1);
+        writeInt(m_File, elapsedTime.asMicroseconds(), 8);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputReplay::load(const std::string& filename)
+    {
+        m_Records.clear();
+
+        std::ifstream file(filename.c_str(), std::ios::binary);
+        if (!file.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open the recording " << filename << ".");
+            return false;
+        }
+
+        char header[sizeof(fileHeader)];
+        if (!file.read(header, sizeof(header)) || !std::equal(header, header + sizeof(header), fileHeader))
+        {
+            TGUI_OUTPUT("TGUI error: " << filename << " is not a recording or was made with a different version of tgui.");
+            return false;
+        }
+
+        while (file.peek() != std::char_traits<char>::eof())
+        {
+            Record record;
+            record.type = static_cast<sf::Uint8>(readInt(file, 1));
+
+            if (record.type == Record_Event)
+            {
+                sf::Event& event = record.event;
+                event.type = static_cast<sf::Event::EventType>(readInt(file, 1));
+
+                switch (event.type)
+                {
+                    case sf::Event::Resized:
+                        event.size.width = static_cast<unsigned int>(readInt(file, 4));
+                        event.size.height = static_cast<unsigned int>(readInt(file, 4));
+                        break;
+
+                    case sf::Event::TextEntered:
+                        event.text.unicode = static_cast<sf::Uint32>(readInt(file, 4));
+                        break;
+
+                    case sf::Event::KeyPressed:
+                    case sf::Event::KeyReleased:
+                    {
+                        event.key.code = static_cast<sf::Keyboard::Key>(readInt(file, 4));
+
+                        const sf::Int64 modifiers = readInt(file, 1);
+                        event.key.alt = (modifiers & 1) != 0;
+                        event.key.control = (modifiers & 2) != 0;
+                        event.key.shift = (modifiers & 4) != 0;
+                        event.key.system = (modifiers & 8) != 0;
+                        break;
+                    }
+
+                    case sf::Event::MouseWheelMoved:
+                        event.mouseWheel.delta = static_cast<int>(readInt(file, 4));
+                        event.mouseWheel.x = static_cast<int>(readInt(file, 4));
+                        event.mouseWheel.y = static_cast<int>(readInt(file, 4));
+                        break;
+
+                    case sf::Event::MouseButtonPressed:
+                    case sf::Event::MouseButtonReleased:
+                        event.mouseButton.button = static_cast<sf::Mouse::Button>(readInt(file, 1));
+                        event.mouseButton.x = static_cast<int>(readInt(file, 4));
+                        event.mouseButton.y = static_cast<int>(readInt(file, 4));
+                        break;
+
+                    case sf::Event::MouseMoved:
+                        event.mouseMove.x = static_cast<int>(readInt(file, 4));
+                        event.mouseMove.y = static_cast<int>(readInt(file, 4));
+                        break;
+
+                    default: // The other events have no members
+                        break;
+                }
+            }
+            else if ((record.type == Record_Update) || (record.type == Record_Frame))
+            {
+                record.time = sf::microseconds(readInt(file, 8));
+            }
+            else
+            {
+                TGUI_OUTPUT("TGUI error: The recording " << filename << " is corrupt.");
+                m_Records.clear();
+                return false;
+            }
+
+            if (!file)
+            {
+                TGUI_OUTPUT("TGUI error: The recording " << filename << " ends in the middle of a record.");
+                m_Records.clear();
+                return false;
+            }
+
+            m_Records.push_back(record);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputReplay::replay(Gui& gui)
+    {
+        m_FrameTimes.clear();
+
+        if (m_Records.empty())
+            return false;
+
+        gui.setClock(this);
+
+        Callback callback;
+        for (std::vector<Record>::const_iterator it = m_Records.begin(); it != m_Records.end(); ++it)
+        {
+            if (it->type == Record_Event)
+            {
+                gui.handleEvent(it->event);
+
+                // Nobody is going to handle the callbacks, so they would only keep piling up
+                while (gui.pollCallback(callback))
+                {
+                }
+            }
+            else if (it->type == Record_Update)
+            {
+                gui.updateTime(it->time);
+            }
+            else // Record_Frame
+            {
+                m_FrameTime = it->time;
+
+                sf::Clock clock;
+                gui.draw();
+                m_FrameTimes.push_back(clock.getElapsedTime());
+            }
+        }
+
+        gui.setClock(nullptr);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::Time>& InputReplay::getFrameTimes() const
+    {
+        return m_FrameTimes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time InputReplay::getElapsedTime() const
+    {
+        return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time InputReplay::restart()
+    {
+        const sf::Time elapsedTime = m_FrameTime;
+        m_FrameTime = sf::Time::Zero;
+        return elapsedTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Label.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,6 +64,10 @@ namespace tgui
 
     bool Label::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Label::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // Open the config file
@@ -112,6 +118,8 @@ namespace tgui
 
     void Label::setSize(float width, float height)
     {
+        markDirty();
+
         // A negative size is not allowed for this object
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -130,25 +138,33 @@ namespace tgui
 
     void Label::setPosition(float x, float y)
     {
+        markDirty();
+
         Transformable::setPosition(x, y);
 
         m_Text.setPosition(std::floor(x + 0.5f), std::floor(y + 0.5f));
-        m_Background.setPosition(x + m_Text.getLocalBounds().left, y + m_Text.getLocalBounds().top);
+
+        const sf::FloatRect bounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+        m_Background.setPosition(x + bounds.left, y + bounds.top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::setText(const sf::String& string)
     {
+        TGUI_PROFILE_ZONE("Label::setText");
+
+        markDirty();
+
         m_Text.setString(string);
 
-        m_Background.setPosition(getPosition().x + m_Text.getLocalBounds().left, getPosition().y + m_Text.getLocalBounds().top);
+        const sf::FloatRect bounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+        m_Background.setPosition(getPosition().x + bounds.left, getPosition().y + bounds.top);
 
         // Change the size of the label if necessary
         if (m_AutoSize)
         {
-            m_Size = sf::Vector2f(m_Text.getLocalBounds().left + m_Text.getLocalBounds().width,
-                                  m_Text.getLocalBounds().top + m_Text.getLocalBounds().height);
+            m_Size = sf::Vector2f(bounds.left + bounds.width, bounds.top + bounds.height);
 
             m_Background.setSize(m_Size);
         }
@@ -165,7 +181,10 @@ namespace tgui
 
     void Label::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Text.setFont(font);
+        TGUI_FontManager.trackText(m_Text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +198,8 @@ namespace tgui
 
     void Label::setTextColor(const sf::Color& color)
     {
+        markDirty();
+
         m_Text.setColor(color);
     }
 
@@ -193,15 +214,17 @@ namespace tgui
 
     void Label::setTextSize(unsigned int size)
     {
+        markDirty();
+
         m_Text.setCharacterSize(size);
 
-        m_Background.setPosition(getPosition().x + m_Text.getLocalBounds().left, getPosition().y + m_Text.getLocalBounds().top);
+        const sf::FloatRect bounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+        m_Background.setPosition(getPosition().x + bounds.left, getPosition().y + bounds.top);
 
         // Change the size of the label if necessary
         if (m_AutoSize)
         {
-            m_Size = sf::Vector2f(m_Text.getLocalBounds().left + m_Text.getLocalBounds().width,
-                                  m_Text.getLocalBounds().top + m_Text.getLocalBounds().height);
+            m_Size = sf::Vector2f(bounds.left + bounds.width, bounds.top + bounds.height);
 
             m_Background.setSize(m_Size);
         }
@@ -218,6 +241,8 @@ namespace tgui
 
     void Label::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_Background.setFillColor(backgroundColor);
     }
 
@@ -232,13 +257,15 @@ namespace tgui
 
     void Label::setAutoSize(bool autoSize)
     {
+        markDirty();
+
         m_AutoSize = autoSize;
 
         // Change the size of the label if necessary
         if (m_AutoSize)
         {
-            m_Size = sf::Vector2f(m_Text.getLocalBounds().left + m_Text.getLocalBounds().width,
-                                  m_Text.getLocalBounds().top + m_Text.getLocalBounds().height);
+            const sf::FloatRect bounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+            m_Size = sf::Vector2f(bounds.left + bounds.width, bounds.top + bounds.height);
 
             m_Background.setSize(m_Size);
         }
@@ -255,6 +282,8 @@ namespace tgui
 
     void Label::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         if (m_Background.getFillColor().a != 0)
@@ -345,6 +374,8 @@ namespace tgui
 
     void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Label::draw");
+
         // When there is no text then there is nothing to draw
         if (m_Text.getString().isEmpty())
             return;
@@ -354,8 +385,9 @@ namespace tgui
         float scaleViewY = target.getSize().y / target.getView().getSize().y;
 
         // Get the global position
-        sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() + sf::Vector2f(m_Text.getLocalBounds().left, m_Text.getLocalBounds().top) - target.getView().getCenter() + (target.getView().getSize() / 2.f));
-        sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + sf::Vector2f(m_Text.getLocalBounds().left, m_Text.getLocalBounds().top) + m_Size - target.getView().getCenter() + (target.getView().getSize() / 2.f));
+        const sf::FloatRect bounds = TGUI_TextMeasurementCache.getLocalBounds(m_Text);
+        sf::Vector2f topLeftPosition = states.transform.transformPoint(getPosition() + sf::Vector2f(bounds.left, bounds.top) - target.getView().getCenter() + (target.getView().getSize() / 2.f));
+        sf::Vector2f bottomRightPosition = states.transform.transformPoint(getPosition() + sf::Vector2f(bounds.left, bounds.top) + m_Size - target.getView().getCenter() + (target.getView().getSize() / 2.f));
 
         // Get the old clipping area
         GLint scissor[4];
@@ -374,17 +406,17 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Draw the background
         if (m_Background.getFillColor() != sf::Color::Transparent)
-            target.draw(m_Background, states);
+            drawCounted(target, m_Background, states);
 
         // Draw the text
-        target.draw(m_Text, states);
+        drawCounted(target, m_Text, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
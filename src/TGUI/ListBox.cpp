@@ -30,6 +30,8 @@
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/ListBox.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,7 +46,10 @@ namespace tgui
     m_TextSize    (19),
     m_MaxItems    (0),
     m_Scroll      (nullptr),
-    m_TextFont    (nullptr)
+    m_TextFont    (nullptr),
+    m_ItemVerticesFont    (nullptr),
+    m_ItemVerticesTextSize(0),
+    m_TextVertices        (sf::Quads)
     {
         m_Callback.widgetType = Type_ListBox;
         m_DraggableWidget = true;
@@ -70,7 +75,10 @@ namespace tgui
     m_SelectedBackgroundColor(copy.m_SelectedBackgroundColor),
     m_SelectedTextColor      (copy.m_SelectedTextColor),
     m_BorderColor            (copy.m_BorderColor),
-    m_TextFont               (copy.m_TextFont)
+    m_TextFont               (copy.m_TextFont),
+    m_ItemVerticesFont       (nullptr),
+    m_ItemVerticesTextSize   (0),
+    m_TextVertices           (sf::Quads)
     {
         // If there is a scrollbar then copy it
         if (copy.m_Scroll != nullptr)
@@ -134,6 +142,10 @@ namespace tgui
 
     bool ListBox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("ListBox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // If there already was a scrollbar then delete it now
@@ -246,6 +258,8 @@ namespace tgui
 
     void ListBox::setSize(float width, float height)
     {
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -285,6 +299,8 @@ namespace tgui
                                const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor,
                                const sf::Color& borderColor)
     {
+        markDirty();
+
         // Store the new colors
         m_BackgroundColor         = backgroundColor;
         m_TextColor               = textColor;
@@ -297,6 +313,8 @@ namespace tgui
 
     void ListBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -304,6 +322,8 @@ namespace tgui
 
     void ListBox::setTextColor(const sf::Color& textColor)
     {
+        markDirty();
+
         m_TextColor = textColor;
     }
 
@@ -311,6 +331,8 @@ namespace tgui
 
     void ListBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        markDirty();
+
         m_SelectedBackgroundColor = selectedBackgroundColor;
     }
 
@@ -318,6 +340,8 @@ namespace tgui
 
     void ListBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        markDirty();
+
         m_SelectedTextColor = selectedTextColor;
     }
 
@@ -325,6 +349,8 @@ namespace tgui
 
     void ListBox::setBorderColor(const sf::Color& borderColor)
     {
+        markDirty();
+
         m_BorderColor = borderColor;
     }
 
@@ -367,6 +393,8 @@ namespace tgui
 
     void ListBox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_TextFont = &font;
     }
 
@@ -379,8 +407,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int ListBox::getTextSize() const
+    {
+        return m_TextSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     int ListBox::addItem(const sf::String& itemName)
     {
+        markDirty();
+
         // Check if the item limit is reached (if there is one)
         if ((m_MaxItems == 0) || (m_Items.size() < m_MaxItems))
         {
@@ -420,7 +457,12 @@ namespace tgui
             if (m_Items[i] == itemName)
             {
                 // Select the item
-                m_SelectedItem = static_cast<int>(i);
+                if (m_SelectedItem != static_cast<int>(i))
+                {
+                    markDirty();
+                    m_SelectedItem = static_cast<int>(i);
+                }
+
                 return true;
             }
         }
@@ -428,7 +470,7 @@ namespace tgui
         TGUI_OUTPUT("TGUI warning: Failed to select the item in the list box. The name didn't match any item.");
 
         // No match was found
-        m_SelectedItem = -1;
+        deselectItem();
         return false;
     }
 
@@ -440,12 +482,17 @@ namespace tgui
         if (index > m_Items.size()-1)
         {
             TGUI_OUTPUT("TGUI warning: Failed to select the item in the list box. The index was too high.");
-            m_SelectedItem = -1;
+            deselectItem();
             return false;
         }
 
         // Select the item
-        m_SelectedItem = index;
+        if (m_SelectedItem != static_cast<int>(index))
+        {
+            markDirty();
+            m_SelectedItem = index;
+        }
+
         return true;
     }
 
@@ -453,6 +500,9 @@ namespace tgui
 
     void ListBox::deselectItem()
     {
+        if (m_SelectedItem != -1)
+            markDirty();
+
         m_SelectedItem = -1;
     }
 
@@ -467,6 +517,8 @@ namespace tgui
             return false;
         }
 
+        markDirty();
+
         // Remove the item
         m_Items.erase(m_Items.begin() + index);
 
@@ -493,6 +545,8 @@ namespace tgui
             // When the name matches then delete the item
             if (m_Items[i] == itemName)
             {
+                markDirty();
+
                 m_Items.erase(m_Items.begin() + i);
 
                 // Check if the selected item should change
@@ -517,6 +571,8 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        markDirty();
+
         // Clear the list, remove all items
         m_Items.clear();
 
@@ -588,6 +644,8 @@ namespace tgui
 
     bool ListBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        markDirty();
+
         // Calling setScrollbar with an empty string does the same as removeScrollbar
         if (scrollbarConfigFileFilename.empty() == true)
         {
@@ -625,6 +683,8 @@ namespace tgui
 
     void ListBox::removeScrollbar()
     {
+        markDirty();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -644,6 +704,8 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        markDirty();
+
         // There is a minimum height
         if (itemHeight < 10)
             itemHeight = 10;
@@ -683,6 +745,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(unsigned int maximumItems)
     {
+        markDirty();
+
         // Set the new limit
         m_MaxItems = maximumItems;
 
@@ -709,6 +773,8 @@ namespace tgui
 
     void ListBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        markDirty();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -746,6 +812,8 @@ namespace tgui
 
     void ListBox::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
         if (m_Scroll != nullptr)
@@ -795,6 +863,8 @@ namespace tgui
 
     void ListBox::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         // Set the mouse down flag to true
         m_MouseDown = true;
 
@@ -872,6 +942,8 @@ namespace tgui
 
     void ListBox::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         // If there is a scrollbar then pass it the event
         if (m_Scroll != nullptr)
         {
@@ -924,6 +996,10 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            // The list box only has to be drawn again when the scrollbar changes
+            const unsigned int oldValue = m_Scroll->getValue();
+            const bool oldMouseHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + (m_Size.x - m_RightBorder - m_Scroll->getSize().x), getPosition().y + m_TopBorder);
 
@@ -942,6 +1018,9 @@ namespace tgui
 
             // Reset the position
             m_Scroll->setPosition(0, 0);
+
+            if ((oldValue != m_Scroll->getValue()) || (oldMouseHover != m_Scroll->m_MouseHover))
+                markDirty();
         }
     }
 
@@ -954,6 +1033,8 @@ namespace tgui
         {
             if (m_Scroll->getLowValue() < m_Scroll->getMaximum())
             {
+                markDirty();
+
                 // Check if you are scrolling down
                 if (delta < 0)
                 {
@@ -1097,6 +1178,8 @@ namespace tgui
 
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("ListBox::draw");
+
         // Calculate the scale factor of the view
         float scaleViewX = target.getSize().x / target.getView().getSize().x;
         float scaleViewY = target.getSize().y / target.getView().getSize().y;
@@ -1129,21 +1212,21 @@ namespace tgui
             // Draw left border
             sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y)));
             border.setFillColor(m_BorderColor);
-            target.draw(border, states);
+            drawCounted(target, border, states);
 
             // Draw top border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_TopBorder)));
-            target.draw(border, states);
+            drawCounted(target, border, states);
 
             // Draw right border
             border.setPosition(static_cast<float>(m_Size.x - m_RightBorder), 0);
             border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y)));
-            target.draw(border, states);
+            drawCounted(target, border, states);
 
             // Draw bottom border
             border.setPosition(0, static_cast<float>(m_Size.y - m_BottomBorder));
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_BottomBorder)));
-            target.draw(border, states);
+            drawCounted(target, border, states);
         }
 
         // Move the front rect a little bit
@@ -1154,7 +1237,7 @@ namespace tgui
             sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x - m_LeftBorder - m_RightBorder),
                                               static_cast<float>(m_Size.y - m_TopBorder - m_BottomBorder)));
             front.setFillColor(m_BackgroundColor);
-            target.draw(front, states);
+            drawCounted(target, front, states);
         }
 
         // Get the old clipping area
@@ -1173,119 +1256,69 @@ namespace tgui
         else if (scissorBottom < scissorTop)
             scissorTop = scissorBottom;
 
-        // Create a text widget to draw the items
-        sf::Text text("", *m_TextFont, m_TextSize);
+        // Set the clipping area
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+
+        // Find out which items should be drawn
+        unsigned int firstItem = 0;
+        unsigned int lastItem = m_Items.size();
+        float scrollOffset = 0;
 
         // Check if there is a scrollbar and whether it isn't hidden
         if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
         {
-            // Store the transformation
-            sf::Transform storedTransform = states.transform;
-
-            // Find out which items should be drawn
-            unsigned int firstItem = m_Scroll->getValue() / m_ItemHeight;
-            unsigned int lastItem = (m_Scroll->getValue() + m_Scroll->getLowValue()) / m_ItemHeight;
+            firstItem = m_Scroll->getValue() / m_ItemHeight;
+            lastItem = (m_Scroll->getValue() + m_Scroll->getLowValue()) / m_ItemHeight;
 
             // Show another item when the scrollbar is standing between two items
             if ((m_Scroll->getValue() + m_Scroll->getLowValue()) % m_ItemHeight != 0)
                 ++lastItem;
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
-            for (unsigned int i = firstItem; i < lastItem; ++i)
-            {
-                // Restore the transformations
-                states.transform = storedTransform;
-
-                // Set the next item
-                text.setString(m_Items[i]);
-
-                // Get the global bounds
-                sf::FloatRect bounds = text.getGlobalBounds();
+            if (lastItem > m_Items.size())
+                lastItem = m_Items.size();
 
-                // Check if we are drawing the selected item
-                if (m_SelectedItem == static_cast<int>(i))
-                {
-                    // Draw a background for the selected item
-                    {
-                        // Set a new transformation
-                        states.transform.translate(0, (static_cast<float>(i * m_ItemHeight) - m_Scroll->getValue()));
-
-                        // Create and draw the background
-                        sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x - m_LeftBorder - m_RightBorder), static_cast<float>(m_ItemHeight)));
-                        back.setFillColor(m_SelectedBackgroundColor);
-                        target.draw(back, states);
-
-                        // Restore the transformation
-                        states.transform = storedTransform;
-                    }
-
-                    // Change the text color
-                    text.setColor(m_SelectedTextColor);
-                }
-                else // Set the normal text color
-                    text.setColor(m_TextColor);
-
-                // Set the translation for the text
-                states.transform.translate(2, std::floor(static_cast<float>(i * m_ItemHeight) - m_Scroll->getValue() + ((m_ItemHeight - bounds.height) / 2.0f) - bounds.top));
-
-                // Draw the text
-                target.draw(text, states);
-            }
+            scrollOffset = static_cast<float>(m_Scroll->getValue());
         }
-        else // There is no scrollbar or it is invisible
+
+        // Draw a background for the selected item
+        if ((m_SelectedItem >= static_cast<int>(firstItem)) && (m_SelectedItem < static_cast<int>(lastItem)))
         {
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x - m_LeftBorder - m_RightBorder), static_cast<float>(m_ItemHeight)));
+            back.setPosition(0, static_cast<float>(m_SelectedItem * m_ItemHeight) - scrollOffset);
+            back.setFillColor(m_SelectedBackgroundColor);
+            drawCounted(target, back, states);
+        }
 
-            // Store the current transformations
-            sf::Transform storedTransform = states.transform;
+        // Draw the text of all visible items at once
+        if (m_TextFont != nullptr)
+        {
+            updateItemVertices(firstItem, lastItem);
 
-            for (unsigned int i=0; i<m_Items.size(); ++i)
+            m_TextVertices.clear();
+            for (unsigned int i = firstItem; i < lastItem; ++i)
             {
-                // Restore the transformations
-                states.transform = storedTransform;
+                const ItemVertices& item = m_ItemVertices[i];
+                const sf::Color& color = (m_SelectedItem == static_cast<int>(i)) ? m_SelectedTextColor : m_TextColor;
 
-                // Set the next item
-                text.setString(m_Items[i]);
+                // Center the text vertically inside the item
+                const sf::Vector2f offset(2, std::floor(static_cast<float>(i * m_ItemHeight) - scrollOffset + ((m_ItemHeight - item.bounds.height) / 2.0f) - item.bounds.top));
 
-                // Check if we are drawing the selected item
-                if (m_SelectedItem == static_cast<int>(i))
+                for (unsigned int j = 0; j < item.vertices.getVertexCount(); ++j)
                 {
-                    // Draw a background for the selected item
-                    {
-                        // Set a new transformation
-                        states.transform.translate(0, static_cast<float>(i * m_ItemHeight));
-
-                        // Create and draw the background
-                        sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x - m_LeftBorder - m_RightBorder), static_cast<float>(m_ItemHeight)));
-                        back.setFillColor(m_SelectedBackgroundColor);
-                        target.draw(back, states);
-
-                        // Restore the transformation
-                        states.transform = storedTransform;
-                    }
-
-                    // Change the text color
-                    text.setColor(m_SelectedTextColor);
+                    sf::Vertex vertex = item.vertices[j];
+                    vertex.position += offset;
+                    vertex.color = color;
+                    m_TextVertices.append(vertex);
                 }
-                else // Set the normal text color
-                    text.setColor(m_TextColor);
-
-                // Get the global bounds
-                sf::FloatRect bounds = text.getGlobalBounds();
-
-                // Set the translation for the text
-                states.transform.translate(2, std::floor((i * m_ItemHeight) + ((m_ItemHeight - bounds.height) / 2.0f) - bounds.top));
-
-                // Draw the text
-                target.draw(text, states);
             }
+
+            sf::RenderStates textStates = states;
+            textStates.texture = &m_TextFont->getTexture(m_TextSize);
+            drawCounted(target, m_TextVertices, textStates);
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -1300,6 +1333,79 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemVertices(unsigned int firstItem, unsigned int lastItem) const
+    {
+        // All vertices have to be recreated when the font or text size changed
+        if ((m_ItemVerticesFont != m_TextFont) || (m_ItemVerticesTextSize != m_TextSize))
+        {
+            m_ItemVertices.clear();
+            m_ItemVerticesFont = m_TextFont;
+            m_ItemVerticesTextSize = m_TextSize;
+        }
+
+        // Forget the items that are no longer visible
+        m_ItemVertices.erase(m_ItemVertices.begin(), m_ItemVertices.lower_bound(firstItem));
+        m_ItemVertices.erase(m_ItemVertices.lower_bound(lastItem), m_ItemVertices.end());
+
+        const float hspace = static_cast<float>(m_TextFont->getGlyph(L' ', m_TextSize, false).advance);
+        const float vspace = static_cast<float>(m_TextFont->getLineSpacing(m_TextSize));
+
+        for (unsigned int i = firstItem; i < lastItem; ++i)
+        {
+            // Nothing has to be done when the item didn't change (and no other item was inserted or removed before it)
+            ItemVertices& item = m_ItemVertices[i];
+            if (item.string == m_Items[i])
+                continue;
+
+            item.string = m_Items[i];
+            item.vertices.clear();
+
+            TGUI_FontManager.trackString(m_TextFont, m_TextSize, false, item.string);
+
+            // Create the quads of the glyphs in the same way as sf::Text does
+            float x = 0;
+            float y = static_cast<float>(m_TextSize);
+            sf::Uint32 prevChar = 0;
+            for (std::size_t j = 0; j < item.string.getSize(); ++j)
+            {
+                const sf::Uint32 curChar = item.string[j];
+                x += static_cast<float>(m_TextFont->getKerning(prevChar, curChar, m_TextSize));
+                prevChar = curChar;
+
+                switch (curChar)
+                {
+                    case L' ':  x += hspace;         continue;
+                    case L'\t': x += hspace * 4;     continue;
+                    case L'\n': y += vspace; x = 0;  continue;
+                    case L'\v': y += vspace * 4;     continue;
+                }
+
+                const sf::Glyph& glyph = m_TextFont->getGlyph(curChar, m_TextSize, false);
+
+                const float left   = static_cast<float>(glyph.bounds.left);
+                const float top    = static_cast<float>(glyph.bounds.top);
+                const float right  = static_cast<float>(glyph.bounds.left + glyph.bounds.width);
+                const float bottom = static_cast<float>(glyph.bounds.top + glyph.bounds.height);
+
+                const float u1 = static_cast<float>(glyph.textureRect.left);
+                const float v1 = static_cast<float>(glyph.textureRect.top);
+                const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+                const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+                item.vertices.append(sf::Vertex(sf::Vector2f(x + left, y + top), sf::Vector2f(u1, v1)));
+                item.vertices.append(sf::Vertex(sf::Vector2f(x + right, y + top), sf::Vector2f(u2, v1)));
+                item.vertices.append(sf::Vertex(sf::Vector2f(x + right, y + bottom), sf::Vector2f(u2, v2)));
+                item.vertices.append(sf::Vertex(sf::Vector2f(x + left, y + bottom), sf::Vector2f(u1, v2)));
+
+                x += static_cast<float>(glyph.advance);
+            }
+
+            item.bounds = item.vertices.getBounds();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/LoadingBar.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -53,6 +55,8 @@ namespace tgui
     m_Maximum         (copy.m_Maximum),
     m_Value           (copy.m_Value),
     m_SplitImage      (copy.m_SplitImage),
+    m_SpriteBack      (copy.m_SpriteBack),
+    m_SpriteFront     (copy.m_SpriteFront),
     m_Text            (copy.m_Text),
     m_TextSize        (copy.m_TextSize)
     {
@@ -101,6 +105,8 @@ namespace tgui
             std::swap(m_TextureFront_L,   temp.m_TextureFront_L);
             std::swap(m_TextureFront_M,   temp.m_TextureFront_M);
             std::swap(m_TextureFront_R,   temp.m_TextureFront_R);
+            std::swap(m_SpriteBack,       temp.m_SpriteBack);
+            std::swap(m_SpriteFront,      temp.m_SpriteFront);
             std::swap(m_Text,             temp.m_Text);
             std::swap(m_TextSize,         temp.m_TextSize);
         }
@@ -119,6 +125,10 @@ namespace tgui
 
     bool LoadingBar::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("LoadingBar::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -245,6 +255,9 @@ namespace tgui
             {
                 m_Size.x = static_cast<float>(m_TextureBack_L.getSize().x + m_TextureBack_M.getSize().x + m_TextureBack_R.getSize().x);
                 m_Size.y = static_cast<float>(m_TextureBack_M.getSize().y);
+
+                m_SpriteBack.setTextures(m_TextureBack_L, m_TextureBack_M, m_TextureBack_R);
+                m_SpriteFront.setTextures(m_TextureFront_L, m_TextureFront_M, m_TextureFront_R);
             }
             else
             {
@@ -266,11 +279,13 @@ namespace tgui
             }
         }
 
+        // Loading has succeeded
+        m_Loaded = true;
+
         // Calculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
 
-        // Loading has succeeded
-        return m_Loaded = true;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +299,8 @@ namespace tgui
 
     void LoadingBar::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -307,6 +324,8 @@ namespace tgui
 
     void LoadingBar::setMinimum(unsigned int minimum)
     {
+        markDirty();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -326,6 +345,8 @@ namespace tgui
 
     void LoadingBar::setMaximum(unsigned int maximum)
     {
+        markDirty();
+
         // Set the new maximum
         m_Maximum = maximum;
 
@@ -345,6 +366,8 @@ namespace tgui
 
     void LoadingBar::setValue(unsigned int value)
     {
+        markDirty();
+
         // Set the new value
         m_Value = value;
 
@@ -362,6 +385,8 @@ namespace tgui
 
     unsigned int LoadingBar::incrementValue()
     {
+        markDirty();
+
         // When the value is still below the maximum then adjust it
         if (m_Value < m_Maximum)
         {
@@ -420,6 +445,8 @@ namespace tgui
 
     void LoadingBar::setText(const sf::String& text)
     {
+        markDirty();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -433,14 +460,14 @@ namespace tgui
             // Calculate a possible text size
             float size = m_Size.y * 0.85f;
             m_Text.setCharacterSize(static_cast<unsigned int>(size));
-            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - m_Text.getLocalBounds().top));
+            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Text).top));
 
             // Make sure that the text isn't too width
-            if (m_Text.getGlobalBounds().width > (m_Size.x * 0.8f))
+            if (TGUI_TextMeasurementCache.getGlobalBounds(m_Text).width > (m_Size.x * 0.8f))
             {
                 // The text is too width, so make it smaller
-                m_Text.setCharacterSize(static_cast<unsigned int>(size / (m_Text.getGlobalBounds().width / (m_Size.x * 0.8f))));
-                m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - m_Text.getLocalBounds().top));
+                m_Text.setCharacterSize(static_cast<unsigned int>(size / (TGUI_TextMeasurementCache.getGlobalBounds(m_Text).width / (m_Size.x * 0.8f))));
+                m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Text).top));
             }
         }
         else // When the text has a fixed size
@@ -461,7 +488,10 @@ namespace tgui
 
     void LoadingBar::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Text.setFont(font);
+        TGUI_FontManager.trackText(m_Text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -475,6 +505,8 @@ namespace tgui
 
     void LoadingBar::setTextColor(const sf::Color& color)
     {
+        markDirty();
+
         m_Text.setColor(color);
     }
 
@@ -489,6 +521,8 @@ namespace tgui
 
     void LoadingBar::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Change the text size
         m_TextSize = size;
 
@@ -507,14 +541,14 @@ namespace tgui
 
     void LoadingBar::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
-        m_TextureBack_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureBack_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureBack_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureFront_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureFront_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureFront_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+        m_SpriteBack.setColor(sf::Color(255, 255, 255, m_Opacity));
+        m_SpriteFront.setColor(sf::Color(255, 255, 255, m_Opacity));
 
         m_Text.setColor(sf::Color(m_Text.getColor().r, m_Text.getColor().g, m_Text.getColor().b, m_Opacity));
     }
@@ -600,74 +634,14 @@ namespace tgui
         // Check if the image is split
         if (m_SplitImage)
         {
-            // Get the bounds of the sprites
-            sf::IntRect bounds_L = m_TextureFront_L.sprite.getTextureRect();
-            sf::IntRect bounds_M = m_TextureFront_M.sprite.getTextureRect();
-            sf::IntRect bounds_R = m_TextureFront_R.sprite.getTextureRect();
-
-            bounds_L.width = m_TextureBack_L.sprite.getTextureRect().width;
-            bounds_M.width = m_TextureBack_M.sprite.getTextureRect().width;
-            bounds_R.width = m_TextureBack_R.sprite.getTextureRect().width;
-
-            // Calculate the necessary sizes
-            float totalWidth;
-            float middleTextureWidth;
-            float frontSize;
-
-            // Check if the middle image is drawn
-            if (m_TextureBack_L.getSize().x + m_TextureBack_R.getSize().x < m_Size.x)
-            {
-                totalWidth = static_cast<float>(bounds_L.width + bounds_M.width + bounds_R.width);
-                middleTextureWidth = totalWidth - (m_TextureBack_L.getSize().x + m_TextureBack_R.getSize().x);
-            }
-            else // The loading bar is too small
-            {
-                totalWidth = static_cast<float>(bounds_L.width + bounds_R.width);
-                middleTextureWidth = 0;
-            }
+            m_SpriteBack.setSize(m_Size.x, m_Size.y);
+            m_SpriteFront.setSize(m_Size.x, m_Size.y);
 
             // Only change the width when not dividing by zero
             if ((m_Maximum - m_Minimum) > 0)
-                frontSize = totalWidth * ((m_Value - m_Minimum) / static_cast<float>(m_Maximum - m_Minimum));
+                m_SpriteFront.setVisibleWidth(m_Size.x * ((m_Value - m_Minimum) / static_cast<float>(m_Maximum - m_Minimum)));
             else
-                frontSize = totalWidth;
-
-            // Check if a part of the left piece should be visible
-            if (frontSize > 0)
-            {
-                // Check if a piece of the middle part should be drawn
-                if (frontSize > m_TextureBack_L.getSize().x)
-                {
-                    // Check if a piece of the right part should be drawn
-                    if (frontSize > m_TextureBack_L.getSize().x + middleTextureWidth)
-                    {
-                        // Check if the bar is not full
-                        if (frontSize < totalWidth)
-                            bounds_R.width = static_cast<int>(frontSize - ((m_TextureBack_L.getSize().x) + middleTextureWidth));
-                    }
-                    else // Only a part of the middle image should be drawn
-                    {
-                        bounds_M.width = static_cast<int>((frontSize - (m_TextureBack_L.getSize().x)) / middleTextureWidth * m_TextureBack_M.getSize().x);
-                        bounds_R.width = 0;
-                    }
-                }
-                else // Only a part of the left piece should be drawn
-                {
-                    bounds_L.width = static_cast<int>(frontSize);
-                    bounds_M.width = 0;
-                    bounds_R.width = 0;
-                }
-            }
-            else // Nothing should be drawn
-            {
-                bounds_L.width = 0;
-                bounds_M.width = 0;
-                bounds_R.width = 0;
-            }
-
-            m_TextureFront_L.sprite.setTextureRect(bounds_L);
-            m_TextureFront_M.sprite.setTextureRect(bounds_M);
-            m_TextureFront_R.sprite.setTextureRect(bounds_R);
+                m_SpriteFront.setVisibleWidth(m_Size.x);
         }
         else // The image is not split
         {
@@ -697,6 +671,8 @@ namespace tgui
 
     void LoadingBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("LoadingBar::draw");
+
         // Don't draw when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -710,51 +686,8 @@ namespace tgui
         // Check if the image is split
         if (m_SplitImage)
         {
-            // Get the scale the images
-            float scalingY = m_Size.y / m_TextureBack_M.getSize().y;
-
-            // Scale the image
-            states.transform.scale(scalingY, scalingY);
-
-            // Draw the left image of the loading bar
-            target.draw(m_TextureBack_L, states);
-            target.draw(m_TextureFront_L, states);
-
-            // Check if the middle image may be drawn
-            if ((scalingY * (m_TextureBack_L.getSize().x + m_TextureBack_R.getSize().x)) < m_Size.x)
-            {
-                // Put the middle image on the correct position
-                states.transform.translate(m_TextureBack_L.sprite.getGlobalBounds().width, 0);
-
-                // Calculate the scale for our middle image
-                float scaleX = (m_Size.x - ((m_TextureBack_L.getSize().x + m_TextureBack_R.getSize().x) * scalingY)) / m_TextureBack_M.getSize().x;
-
-                // Set the scale for the middle image
-                states.transform.scale(scaleX / scalingY, 1);
-
-                // Draw the middle image
-                target.draw(m_TextureBack_M, states);
-                target.draw(m_TextureFront_M, states);
-
-                // Put the right image on the correct position
-                states.transform.translate(m_TextureBack_M.sprite.getGlobalBounds().width, 0);
-
-                // Set the scale for the right image
-                states.transform.scale(scalingY / scaleX, 1);
-
-                // Draw the right image
-                target.draw(m_TextureBack_R, states);
-                target.draw(m_TextureFront_R, states);
-            }
-            else // The loading bar isn't width enough, we will draw it at minimum size
-            {
-                // Put the right image on the correct position
-                states.transform.translate(m_TextureBack_L.sprite.getGlobalBounds().width, 0);
-
-                // Draw the right image
-                target.draw(m_TextureBack_R, states);
-                target.draw(m_TextureFront_R, states);
-            }
+            drawCounted(target, m_SpriteBack, states);
+            drawCounted(target, m_SpriteFront, states);
         }
         else // The image is not split
         {
@@ -762,8 +695,8 @@ namespace tgui
             states.transform.scale(m_Size.x / m_TextureBack_M.getSize().x, m_Size.y / m_TextureBack_M.getSize().y);
 
             // Draw the loading bar
-            target.draw(m_TextureBack_M, states);
-            target.draw(m_TextureFront_M, states);
+            drawCounted(target, m_TextureBack_M, states);
+            drawCounted(target, m_TextureFront_M, states);
         }
 
         // Check if there is a text to draw
@@ -773,7 +706,7 @@ namespace tgui
             states.transform = oldTransform;
 
             // Get the current size of the text, so that we can recalculate the position
-            sf::FloatRect rect = m_Text.getGlobalBounds();
+            sf::FloatRect rect = TGUI_TextMeasurementCache.getGlobalBounds(m_Text);
 
             // Calculate the new position for the text
             rect.left = (m_Size.x - rect.width) * 0.5f - rect.left;
@@ -783,7 +716,7 @@ namespace tgui
             states.transform.translate(std::floor(rect.left + 0.5f), std::floor(rect.top + 0.5f));
 
             // Draw the text
-            target.draw(m_Text, states);
+            drawCounted(target, m_Text, states);
         }
     }
 
@@ -0,0 +1,297 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <TGUI/TGUI.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetTypeMemory::WidgetTypeMemory() :
+    widgets(0),
+    bytes  (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureMemory::TextureMemory() :
+    users       (0),
+    imageBytes  (0),
+    textureBytes(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontMemory::FontMemory() :
+    widgets   (0),
+    glyphBytes(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ContainerMemory::ContainerMemory() :
+    type   (Type_Unknown),
+    depth  (0),
+    widgets(0),
+    bytes  (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryStats::MemoryStats() :
+    widgetBytes (0),
+    imageBytes  (0),
+    textureBytes(0),
+    glyphBytes  (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryStats::collect(const Container& container)
+    {
+        // The gui itself is the first container in the list
+        containers.push_back(ContainerMemory());
+        containers.back().name = "Gui";
+
+        unsigned int widgetCount = 0;
+        const std::size_t bytes = addContainer(container, 1, widgetCount);
+        containers.front().widgets = widgetCount;
+        containers.front().bytes = bytes;
+        widgetBytes += bytes;
+
+        // The global font is always listed, even when no widget uses it
+        fonts[&container.getGlobalFont()];
+
+        // Find out how large the glyph caches have become. Asking the font for the texture of a character size at which no
+        // glyph was rendered yet would create a new texture, so only the sizes that were used by the widgets are checked.
+        for (std::map<const sf::Font*, FontMemory>::iterator it = fonts.begin(); it != fonts.end(); ++it)
+        {
+            for (std::vector<unsigned int>::const_iterator sizeIt = it->second.characterSizes.begin(); sizeIt != it->second.characterSizes.end(); ++sizeIt)
+            {
+                if (!TGUI_FontManager.isCharacterSizeUsed(it->first, *sizeIt))
+                    continue;
+
+                const sf::Vector2u size = it->first->getTexture(*sizeIt).getSize();
+                it->second.glyphBytes += static_cast<std::size_t>(size.x) * size.y * 4;
+            }
+
+            glyphBytes += it->second.glyphBytes;
+        }
+
+        const std::list<TextureData>& textureData = TGUI_TextureManager.getTextureData();
+        for (std::list<TextureData>::const_iterator it = textureData.begin(); it != textureData.end(); ++it)
+        {
+            TextureMemory memory;
+            memory.filename = it->filename;
+            memory.users = it->users;
+            memory.imageBytes = it->alphaMask.size() * sizeof(sf::Uint32);
+            memory.textureBytes = static_cast<std::size_t>(it->texture.getSize().x) * it->texture.getSize().y * 4;
+            textures.push_back(memory);
+
+            imageBytes += memory.imageBytes;
+            textureBytes += memory.textureBytes;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryStats::getTotalBytes() const
+    {
+        return widgetBytes + imageBytes + textureBytes + glyphBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryStats::addContainer(const Container& container, unsigned int depth, unsigned int& widgetCount)
+    {
+        const std::vector<Widget::Ptr>& widgets = container.getWidgets();
+        const std::vector<sf::String>& widgetNames = container.getWidgetNames();
+
+        std::size_t bytes = 0;
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+        {
+            const std::size_t widgetSize = addWidget(*widgets[i]);
+            bytes += widgetSize;
+            ++widgetCount;
+
+            // The containers are listed after their parent, in the same order as they are drawn
+            const Container* childContainer = dynamic_cast<const Container*>(widgets[i].get());
+            if (childContainer)
+            {
+                const std::size_t index = containers.size();
+                containers.push_back(ContainerMemory());
+                containers[index].name = widgetNames[i];
+                containers[index].type = widgets[i]->getWidgetType();
+                containers[index].depth = depth;
+
+                unsigned int childCount = 0;
+                const std::size_t childBytes = addContainer(*childContainer, depth + 1, childCount);
+                containers[index].widgets = childCount;
+                containers[index].bytes = widgetSize + childBytes;
+
+                // A child container can have a different global font than its parent
+                fonts[&childContainer->getGlobalFont()];
+
+                widgetCount += childCount;
+                bytes += childBytes;
+            }
+        }
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryStats::addWidget(const Widget& widget)
+    {
+        std::size_t size;
+        switch (widget.getWidgetType())
+        {
+            case Type_ClickableWidget: size = sizeof(ClickableWidget); break;
+            case Type_Picture:         size = sizeof(Picture); break;
+            case Type_Slider:          size = sizeof(Slider); break;
+            case Type_Scrollbar:       size = sizeof(Scrollbar); break;
+            case Type_SpriteSheet:     size = sizeof(SpriteSheet); break;
+            case Type_AnimatedPicture: size = sizeof(AnimatedPicture); break;
+            case Type_SpinButton:      size = sizeof(SpinButton); break;
+            case Type_Slider2d:        size = sizeof(Slider2d); break;
+            case Type_Panel:           size = sizeof(Panel); break;
+            case Type_ChildWindow:     size = sizeof(ChildWindow); break;
+            case Type_Grid:            size = sizeof(Grid); break;
+
+            // The widgets with text also remember which font they use
+            case Type_Button:
+            {
+                size = sizeof(Button);
+                addFont(static_cast<const Button&>(widget).getTextFont(), static_cast<const Button&>(widget).getTextSize());
+                break;
+            }
+            case Type_Checkbox:
+            case Type_RadioButton:
+            {
+                size = (widget.getWidgetType() == Type_Checkbox) ? sizeof(Checkbox) : sizeof(RadioButton);
+                addFont(static_cast<const Checkbox&>(widget).getTextFont(), static_cast<const Checkbox&>(widget).getTextSize());
+                break;
+            }
+            case Type_Label:
+            {
+                size = sizeof(Label);
+                addFont(static_cast<const Label&>(widget).getTextFont(), static_cast<const Label&>(widget).getTextSize());
+                break;
+            }
+            case Type_EditBox:
+            {
+                size = sizeof(EditBox);
+                addFont(static_cast<const EditBox&>(widget).getTextFont(), static_cast<const EditBox&>(widget).getTextSize());
+                break;
+            }
+            case Type_ListBox:
+            {
+                size = sizeof(ListBox);
+                addFont(static_cast<const ListBox&>(widget).getTextFont(), static_cast<const ListBox&>(widget).getTextSize());
+                break;
+            }
+            case Type_ComboBox:
+            {
+                size = sizeof(ComboBox);
+                addFont(static_cast<const ComboBox&>(widget).getTextFont(), static_cast<const ComboBox&>(widget).getTextSize());
+                break;
+            }
+            case Type_LoadingBar:
+            {
+                size = sizeof(LoadingBar);
+                addFont(static_cast<const LoadingBar&>(widget).getTextFont(), static_cast<const LoadingBar&>(widget).getTextSize());
+                break;
+            }
+            case Type_TextBox:
+            {
+                size = sizeof(TextBox);
+                addFont(static_cast<const TextBox&>(widget).getTextFont(), static_cast<const TextBox&>(widget).getTextSize());
+                break;
+            }
+            case Type_Tab:
+            {
+                size = sizeof(Tab);
+                addFont(static_cast<const Tab&>(widget).getTextFont(), static_cast<const Tab&>(widget).getTextSize());
+                break;
+            }
+            case Type_MenuBar:
+            {
+                size = sizeof(MenuBar);
+                addFont(static_cast<const MenuBar&>(widget).getTextFont(), static_cast<const MenuBar&>(widget).getTextSize());
+                break;
+            }
+            case Type_ChatBox:
+            {
+                size = sizeof(ChatBox);
+                addFont(static_cast<const ChatBox&>(widget).getTextFont(), static_cast<const ChatBox&>(widget).getTextSize());
+                break;
+            }
+            case Type_MessageBox:
+            {
+                size = sizeof(MessageBox);
+                addFont(static_cast<const MessageBox&>(widget).getTextFont(), static_cast<const MessageBox&>(widget).getTextSize());
+                break;
+            }
+            default:
+            {
+                size = sizeof(Widget);
+                break;
+            }
+        }
+
+        WidgetTypeMemory& memory = widgetTypes[widget.getWidgetType()];
+        ++memory.widgets;
+        memory.bytes += size;
+        return size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryStats::addFont(const sf::Font* font, unsigned int characterSize)
+    {
+        if (font == nullptr)
+            return;
+
+        FontMemory& memory = fonts[font];
+        ++memory.widgets;
+
+        if ((characterSize > 0) && (std::find(memory.characterSizes.begin(), memory.characterSizes.end(), characterSize) == memory.characterSizes.end()))
+            memory.characterSizes.push_back(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/MenuBar.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /// \todo Use images instead of a simple color
 
@@ -62,6 +64,10 @@ namespace tgui
 
     bool MenuBar::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("MenuBar::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // Open the config file
@@ -128,6 +134,8 @@ namespace tgui
 
     void MenuBar::setSize(float width, float height)
     {
+        markDirty();
+
         m_Size.x = width;
         m_Size.y = height;
 
@@ -145,6 +153,8 @@ namespace tgui
 
     void MenuBar::addMenu(const sf::String& text)
     {
+        markDirty();
+
         Menu menu;
 
         menu.selectedMenuItem = -1;
@@ -153,7 +163,8 @@ namespace tgui
         menu.text.setString(text);
         menu.text.setColor(m_TextColor);
         menu.text.setCharacterSize(m_TextSize);
-        menu.text.setCharacterSize(static_cast<unsigned int>(menu.text.getCharacterSize() - menu.text.getLocalBounds().top));
+        menu.text.setCharacterSize(static_cast<unsigned int>(menu.text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(menu.text).top));
+        TGUI_FontManager.trackText(menu.text);
 
         m_Menus.push_back(menu);
     }
@@ -173,9 +184,11 @@ namespace tgui
                 menuItem.setString(text);
                 menuItem.setColor(m_TextColor);
                 menuItem.setCharacterSize(m_TextSize);
-                menuItem.setCharacterSize(static_cast<unsigned int>(menuItem.getCharacterSize() - menuItem.getLocalBounds().top));
+                menuItem.setCharacterSize(static_cast<unsigned int>(menuItem.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(menuItem).top));
+                TGUI_FontManager.trackText(menuItem);
 
                 m_Menus[i].menuItems.push_back(menuItem);
+                markDirty();
                 return true;
             }
         }
@@ -194,6 +207,7 @@ namespace tgui
             // If this is the menu then remove it
             if (m_Menus[i].text.getString() == menu)
             {
+                markDirty();
                 m_Menus.erase(m_Menus.begin() + i);
 
                 // The menu was removed, so it can't remain open
@@ -223,6 +237,7 @@ namespace tgui
                     // If this is the menu item then remove it
                     if (m_Menus[i].menuItems[j].getString() == menuItem)
                     {
+                        markDirty();
                         m_Menus[i].menuItems.erase(m_Menus[i].menuItems.begin() + j);
 
                         // The item can't still be selected
@@ -244,6 +259,8 @@ namespace tgui
     void MenuBar::changeColors(const sf::Color& backgroundColor, const sf::Color& textColor,
                                const sf::Color& selectedBackgroundColor, const sf::Color& selectedTextColor)
     {
+        markDirty();
+
         m_BackgroundColor = backgroundColor;
         m_TextColor = textColor;
         m_SelectedBackgroundColor = selectedBackgroundColor;
@@ -267,6 +284,8 @@ namespace tgui
 
     void MenuBar::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -274,6 +293,8 @@ namespace tgui
 
     void MenuBar::setTextColor(const sf::Color& textColor)
     {
+        markDirty();
+
         m_TextColor = textColor;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -292,6 +313,8 @@ namespace tgui
 
     void MenuBar::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
+        markDirty();
+
         m_SelectedBackgroundColor = selectedBackgroundColor;
     }
 
@@ -299,6 +322,8 @@ namespace tgui
 
     void MenuBar::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        markDirty();
+
         m_SelectedTextColor = selectedTextColor;
 
         if (m_VisibleMenu != -1)
@@ -340,6 +365,8 @@ namespace tgui
 
     void MenuBar::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_TextFont = &font;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -366,6 +393,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        markDirty();
+
         m_TextSize = size;
 
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
@@ -373,11 +402,13 @@ namespace tgui
             for (unsigned int j = 0; j < m_Menus[i].menuItems.size(); ++j)
             {
                 m_Menus[i].menuItems[j].setCharacterSize(m_TextSize);
-                m_Menus[i].menuItems[j].setCharacterSize(static_cast<unsigned int>(m_Menus[i].menuItems[j].getCharacterSize() - m_Menus[i].menuItems[j].getLocalBounds().top));
+                m_Menus[i].menuItems[j].setCharacterSize(static_cast<unsigned int>(m_Menus[i].menuItems[j].getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].menuItems[j]).top));
+                TGUI_FontManager.trackText(m_Menus[i].menuItems[j]);
             }
 
             m_Menus[i].text.setCharacterSize(m_TextSize);
-            m_Menus[i].text.setCharacterSize(static_cast<unsigned int>(m_Menus[i].text.getCharacterSize() - m_Menus[i].text.getLocalBounds().top));
+            m_Menus[i].text.setCharacterSize(static_cast<unsigned int>(m_Menus[i].text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].text).top));
+            TGUI_FontManager.trackText(m_Menus[i].text);
         }
     }
 
@@ -392,6 +423,8 @@ namespace tgui
 
     void MenuBar::setDistanceToSide(unsigned int distanceToSide)
     {
+        markDirty();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -406,6 +439,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(unsigned int minimumWidth)
     {
+        markDirty();
+
         m_MinimumSubMenuWidth = minimumWidth;
     }
 
@@ -420,6 +455,8 @@ namespace tgui
 
     void MenuBar::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
         m_BackgroundColor.a = m_Opacity;
@@ -455,14 +492,14 @@ namespace tgui
                     // Search the left position of the open menu
                     float left = 0;
                     for (int i = 0; i < m_VisibleMenu; ++i)
-                        left += m_Menus[i].text.getLocalBounds().width + (2 * m_DistanceToSide);
+                        left += TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].text).width + (2 * m_DistanceToSide);
 
                     // Find out what the width of the menu should be
                     float width = 0;
                     for (unsigned int j = 0; j < m_Menus[m_VisibleMenu].menuItems.size(); ++j)
                     {
-                        if (width < m_Menus[m_VisibleMenu].menuItems[j].getLocalBounds().width + (3 * m_DistanceToSide))
-                            width = m_Menus[m_VisibleMenu].menuItems[j].getLocalBounds().width + (3 * m_DistanceToSide);
+                        if (width < TGUI_TextMeasurementCache.getLocalBounds(m_Menus[m_VisibleMenu].menuItems[j]).width + (3 * m_DistanceToSide))
+                            width = TGUI_TextMeasurementCache.getLocalBounds(m_Menus[m_VisibleMenu].menuItems[j]).width + (3 * m_DistanceToSide);
                     }
 
                     // There is a minimum width
@@ -487,6 +524,8 @@ namespace tgui
 
     void MenuBar::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         // Check if a menu should be opened or closed
         if (y <= m_Size.y + getPosition().y)
         {
@@ -494,7 +533,7 @@ namespace tgui
             float menuWidth = 0;
             for (unsigned int i = 0; i < m_Menus.size(); ++i)
             {
-                menuWidth += m_Menus[i].text.getLocalBounds().width + (2 * m_DistanceToSide);
+                menuWidth += TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].text).width + (2 * m_DistanceToSide);
                 if (x < menuWidth)
                 {
                     // Close the menu when it was already open
@@ -525,6 +564,8 @@ namespace tgui
 
     void MenuBar::leftMouseReleased(float, float y)
     {
+        markDirty();
+
         if (m_MouseDown)
         {
             // Check if the mouse is on top of one of the menus
@@ -573,7 +614,7 @@ namespace tgui
                 float menuWidth = 0;
                 for (unsigned int i = 0; i < m_Menus.size(); ++i)
                 {
-                    menuWidth += m_Menus[i].text.getLocalBounds().width + (2 * m_DistanceToSide);
+                    menuWidth += TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].text).width + (2 * m_DistanceToSide);
                     if (x < menuWidth)
                     {
                         // Check if the menu is already open
@@ -582,12 +623,16 @@ namespace tgui
                             // If one of the menu items is selected then unselect it
                             if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
                             {
+                                markDirty();
+
                                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_TextColor);
                                 m_Menus[m_VisibleMenu].selectedMenuItem = -1;
                             }
                         }
                         else // The menu isn't open yet
                         {
+                            markDirty();
+
                             // If there is another menu open then close it first
                             if (m_VisibleMenu != -1)
                             {
@@ -618,6 +663,8 @@ namespace tgui
             // Check if the mouse is on a different item than before
             if (selectedMenuItem != m_Menus[m_VisibleMenu].selectedMenuItem)
             {
+                markDirty();
+
                 // If another of the menu items is selected then unselect it
                 if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
                     m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_TextColor);
@@ -636,6 +683,8 @@ namespace tgui
         // Check if there is still a menu open
         if (m_VisibleMenu != -1)
         {
+            markDirty();
+
             // If an item in that menu was selected then unselect it first
             if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
             {
@@ -741,18 +790,20 @@ namespace tgui
 
     void MenuBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("MenuBar::draw");
+
         states.transform *= getTransform();
 
         // Draw the background
         sf::RectangleShape background(m_Size);
         background.setFillColor(m_BackgroundColor);
-        target.draw(background, states);
+        drawCounted(target, background, states);
 
         // Draw the menus
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
             states.transform.translate(static_cast<float>(m_DistanceToSide), 0);
-            target.draw(m_Menus[i].text, states);
+            drawCounted(target, m_Menus[i].text, states);
 
             // Is the menu open?
             if (m_VisibleMenu == static_cast<int>(i))
@@ -763,8 +814,8 @@ namespace tgui
                 float menuWidth = 0;
                 for (unsigned int j = 0; j < m_Menus[i].menuItems.size(); ++j)
                 {
-                    if (menuWidth < m_Menus[i].menuItems[j].getLocalBounds().width + (3 * m_DistanceToSide))
-                        menuWidth = m_Menus[i].menuItems[j].getLocalBounds().width + (3 * m_DistanceToSide);
+                    if (menuWidth < TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].menuItems[j]).width + (3 * m_DistanceToSide))
+                        menuWidth = TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].menuItems[j]).width + (3 * m_DistanceToSide);
                 }
 
                 // There is a minimum width
@@ -774,7 +825,7 @@ namespace tgui
                 // Draw the background of the menu
                 background = sf::RectangleShape(sf::Vector2f(menuWidth, m_Size.y * m_Menus[i].menuItems.size()));
                 background.setFillColor(m_BackgroundColor);
-                target.draw(background, states);
+                drawCounted(target, background, states);
 
                 // If there is a selected menu item then draw its background
                 if (m_Menus[i].selectedMenuItem != -1)
@@ -782,7 +833,7 @@ namespace tgui
                     states.transform.translate(0, m_Menus[i].selectedMenuItem * m_Size.y);
                     background = sf::RectangleShape(sf::Vector2f(menuWidth, m_Size.y));
                     background.setFillColor(m_SelectedBackgroundColor);
-                    target.draw(background, states);
+                    drawCounted(target, background, states);
                     states.transform.translate(0, m_Menus[i].selectedMenuItem * -m_Size.y);
                 }
 
@@ -791,15 +842,15 @@ namespace tgui
                 // Draw the menu items
                 for (unsigned int j = 0; j < m_Menus[i].menuItems.size(); ++j)
                 {
-                    target.draw(m_Menus[i].menuItems[j], states);
+                    drawCounted(target, m_Menus[i].menuItems[j], states);
                     states.transform.translate(0, m_Size.y);
                 }
 
-                states.transform.translate(m_Menus[i].text.getLocalBounds().width, -m_Size.y * (m_Menus[i].menuItems.size()+1));
+                states.transform.translate(TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].text).width, -m_Size.y * (m_Menus[i].menuItems.size()+1));
             }
             else // The menu isn't open
             {
-                states.transform.translate(m_Menus[i].text.getLocalBounds().width + m_DistanceToSide, 0);
+                states.transform.translate(TGUI_TextMeasurementCache.getLocalBounds(m_Menus[i].text).width + m_DistanceToSide, 0);
             }
         }
     }
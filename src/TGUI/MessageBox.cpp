@@ -25,6 +25,7 @@
 
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/MessageBox.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -86,6 +87,10 @@ namespace tgui
 
     bool MessageBox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("MessageBox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -195,6 +200,8 @@ namespace tgui
 
     void MessageBox::setText(const sf::String& text)
     {
+        markDirty();
+
         if (m_Loaded)
         {
             m_Label->setText(text);
@@ -224,6 +231,8 @@ namespace tgui
 
     void MessageBox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Label->setTextFont(font);
     }
 
@@ -238,6 +247,8 @@ namespace tgui
 
     void MessageBox::setTextColor(const sf::Color& color)
     {
+        markDirty();
+
         m_Label->setTextColor(color);
     }
 
@@ -252,6 +263,8 @@ namespace tgui
 
     void MessageBox::setTextSize(unsigned int size)
     {
+        markDirty();
+
         m_TextSize = size;
 
         if (m_Loaded)
@@ -276,6 +289,8 @@ namespace tgui
 
     void MessageBox::addButton(const sf::String& caption)
     {
+        markDirty();
+
         if (m_Loaded)
         {
             Button::Ptr button(*this);
@@ -352,7 +367,7 @@ namespace tgui
         float buttonHeight = m_TextSize * 10.0f / 8.0f;
         for (unsigned int i = 0; i < m_Buttons.size(); ++i)
         {
-            float width = sf::Text(m_Buttons[i]->getText(), *m_Buttons[i]->getTextFont(), m_TextSize).getLocalBounds().width;
+            float width = TGUI_TextMeasurementCache.getLocalBounds(sf::Text(m_Buttons[i]->getText(), *m_Buttons[i]->getTextFont(), m_TextSize)).width;
             if (buttonWidth < width * 10.0f / 9.0f)
                 buttonWidth = width * 10.0f / 9.0f;
         }
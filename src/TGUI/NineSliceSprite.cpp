@@ -0,0 +1,251 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/RenderStats.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    NineSliceSprite::NineSliceSprite() :
+    m_Mode         (SliceMode_None),
+    m_SharedTexture(true),
+    m_Color        (255, 255, 255),
+    m_VisibleWidth (-1)
+    {
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            m_Textures[i] = nullptr;
+            m_VertexCounts[i] = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::setTextures(const Texture& left, const Texture& middle, const Texture& right, bool vertical)
+    {
+        m_Mode = vertical ? SliceMode_Vertical : SliceMode_Horizontal;
+
+        m_Textures[0] = left.sprite.getTexture();
+        m_Textures[1] = middle.sprite.getTexture();
+        m_Textures[2] = right.sprite.getTexture();
+        m_SharedTexture = (m_Textures[0] == m_Textures[1]) && (m_Textures[1] == m_Textures[2]);
+
+        for (unsigned int row = 0; row < 3; ++row)
+        {
+            for (unsigned int column = 0; column < 3; ++column)
+                m_TextureRects[row][column] = sf::FloatRect();
+        }
+
+        // The images are placed in the middle row (or in the middle column when placed vertically)
+        const Texture* parts[3] = {&left, &middle, &right};
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            sf::FloatRect rect(parts[i]->sprite.getTextureRect());
+
+            if (vertical)
+                m_TextureRects[i][1] = rect;
+            else
+                m_TextureRects[1][i] = rect;
+        }
+
+        updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::setPosition(float x, float y)
+    {
+        m_Position = sf::Vector2f(x, y);
+
+        updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::setSize(float width, float height)
+    {
+        // Widgets may set the size every time they are drawn, so only recalculate when something changed
+        if ((m_Size.x == width) && (m_Size.y == height))
+            return;
+
+        m_Size = sf::Vector2f(width, height);
+
+        updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Vector2f& NineSliceSprite::getSize() const
+    {
+        return m_Size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::setVisibleWidth(float width)
+    {
+        m_VisibleWidth = width;
+
+        updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::setColor(const sf::Color& color)
+    {
+        m_Color = color;
+
+        for (unsigned int i = 0; i < 36; ++i)
+            m_Vertices[i].color = color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int NineSliceSprite::getDrawCallCount() const
+    {
+        if (m_Mode == SliceMode_None)
+            return 0;
+        else if (m_SharedTexture)
+            return 1;
+        else
+            return 3;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::updateVertices()
+    {
+        for (unsigned int i = 0; i < 3; ++i)
+            m_VertexCounts[i] = 0;
+
+        if (m_Mode == SliceMode_None)
+            return;
+
+        // Calculate the size of the borders on the screen
+        float left, right, top, bottom;
+        if (m_Mode == SliceMode_Horizontal)
+        {
+            // The left and right images keep their ratio
+            float scaling = m_Size.y / m_TextureRects[1][1].height;
+            left = m_TextureRects[1][0].width * scaling;
+            right = m_TextureRects[1][2].width * scaling;
+            top = 0;
+            bottom = 0;
+        }
+        else // if (m_Mode == SliceMode_Vertical)
+        {
+            // The top and bottom images keep their ratio
+            float scaling = m_Size.x / m_TextureRects[1][1].width;
+            top = m_TextureRects[0][1].height * scaling;
+            bottom = m_TextureRects[2][1].height * scaling;
+            left = 0;
+            right = 0;
+        }
+
+        // The middle part isn't drawn when the borders don't fit inside the sprite
+        float middleWidth = (m_Size.x > left + right) ? (m_Size.x - left - right) : 0;
+        float middleHeight = (m_Size.y > top + bottom) ? (m_Size.y - top - bottom) : 0;
+
+        float x[4] = {m_Position.x, m_Position.x + left, m_Position.x + left + middleWidth, m_Position.x + left + middleWidth + right};
+        float y[4] = {m_Position.y, m_Position.y + top, m_Position.y + top + middleHeight, m_Position.y + top + middleHeight + bottom};
+
+        // Parts that lie behind the visible width are cut off
+        float visibleRight = (m_VisibleWidth < 0) ? x[3] : m_Position.x + m_VisibleWidth;
+
+        // Create a quad for every visible part, grouped by texture
+        unsigned int vertexCount = 0;
+        for (unsigned int group = 0; group < 3; ++group)
+        {
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                unsigned int row = (m_Mode == SliceMode_Vertical) ? group : i;
+                unsigned int column = (m_Mode == SliceMode_Vertical) ? i : group;
+
+                sf::FloatRect textureRect = m_TextureRects[row][column];
+                if ((x[column+1] <= x[column]) || (y[row+1] <= y[row]) || (textureRect.width == 0) || (textureRect.height == 0))
+                    continue;
+
+                // Only the visible part of the quad is created
+                float quadRight = x[column+1];
+                if (quadRight > visibleRight)
+                {
+                    if (visibleRight <= x[column])
+                        continue;
+
+                    textureRect.width *= (visibleRight - x[column]) / (quadRight - x[column]);
+                    quadRight = visibleRight;
+                }
+
+                sf::Vertex* quad = &m_Vertices[vertexCount];
+                quad[0] = sf::Vertex(sf::Vector2f(x[column], y[row]), m_Color, sf::Vector2f(textureRect.left, textureRect.top));
+                quad[1] = sf::Vertex(sf::Vector2f(quadRight, y[row]), m_Color, sf::Vector2f(textureRect.left + textureRect.width, textureRect.top));
+                quad[2] = sf::Vertex(sf::Vector2f(quadRight, y[row+1]), m_Color, sf::Vector2f(textureRect.left + textureRect.width, textureRect.top + textureRect.height));
+                quad[3] = sf::Vertex(sf::Vector2f(x[column], y[row+1]), m_Color, sf::Vector2f(textureRect.left, textureRect.top + textureRect.height));
+
+                vertexCount += 4;
+                m_VertexCounts[group] += 4;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void NineSliceSprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        if (m_Mode == SliceMode_None)
+            return;
+
+        if (m_SharedTexture)
+        {
+            states.texture = m_Textures[0];
+
+            if (TGUI_RenderStats)
+                TGUI_RenderStats->addDrawCall(m_Textures[0], m_VertexCounts[0] + m_VertexCounts[1] + m_VertexCounts[2]);
+
+            target.draw(m_Vertices, m_VertexCounts[0] + m_VertexCounts[1] + m_VertexCounts[2], sf::Quads, states);
+        }
+        else // Every part has its own texture
+        {
+            unsigned int offset = 0;
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                states.texture = m_Textures[i];
+
+                if (TGUI_RenderStats)
+                    TGUI_RenderStats->addDrawCall(m_Textures[i], m_VertexCounts[i]);
+
+                target.draw(&m_Vertices[offset], m_VertexCounts[i], sf::Quads, states);
+                offset += m_VertexCounts[i];
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
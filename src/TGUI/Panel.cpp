@@ -26,6 +26,8 @@
 #include <SFML/OpenGL.hpp>
 
 #include <TGUI/Panel.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +57,6 @@ namespace tgui
         {
             m_Sprite.setTexture(*m_Texture);
             m_Sprite.setScale(m_Size.x / m_Texture->getSize().x, m_Size.y / m_Texture->getSize().y);
-            m_Sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         }
     }
 
@@ -95,6 +96,8 @@ namespace tgui
 
     void Panel::setSize(float width, float height)
     {
+        markDirty();
+
         // A negative size is not allowed for this widget
         if (width  < 0) width  = -width;
         if (height < 0) height = -height;
@@ -117,8 +120,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect Panel::getOpaqueArea() const
+    {
+        if (m_Loaded && (m_Opacity == 255) && (m_BackgroundColor.a == 255))
+            return sf::FloatRect(0, 0, m_Size.x, m_Size.y);
+        else
+            return sf::FloatRect();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::setBackgroundTexture(sf::Texture *const texture)
     {
+        markDirty();
+
         // Store the texture
         m_Texture = texture;
 
@@ -141,6 +156,8 @@ namespace tgui
 
     void Panel::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -153,17 +170,6 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Panel::setTransparency(unsigned char transparency)
-    {
-        Container::setTransparency(transparency);
-
-        m_BackgroundColor.a = m_Opacity;
-
-        m_Sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     bool Panel::mouseOnWidget(float x, float y)
     {
         // Don't continue when the panel has not been loaded yet
@@ -288,10 +294,19 @@ namespace tgui
 
     void Panel::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Panel::draw");
+
         // Don't draw when the texture wasn't created
         if (m_Loaded == false)
             return;
 
+        // Draw the cached texture instead when caching is enabled
+        if (drawCache(target, states, m_Size))
+            return;
+
+        // Draw everything with the transparency of the panel
+        float oldOpacity = applyOpacity(target, states);
+
         // Calculate the scale factor of the view
         float scaleViewX = target.getSize().x / target.getView().getSize().x;
         float scaleViewY = target.getSize().y / target.getView().getSize().y;
@@ -317,7 +332,7 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Set the transform
         states.transform *= getTransform();
@@ -327,18 +342,20 @@ namespace tgui
         {
             sf::RectangleShape background(m_Size);
             background.setFillColor(m_BackgroundColor);
-            target.draw(background, states);
+            drawCounted(target, background, states);
         }
 
         // Draw the background texture if there is one
         if (m_Texture)
-            target.draw(m_Sprite, states);
+            drawCounted(target, m_Sprite, states);
 
         // Draw the widgets
         drawWidgetContainer(&target, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+
+        restoreOpacity(oldOpacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Picture.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -83,6 +85,10 @@ namespace tgui
 
     bool Picture::load(const std::string& filename)
     {
+        TGUI_PROFILE_ZONE("Picture::load");
+
+        markDirty();
+
         m_LoadedFilename = filename;
 
         // When everything is loaded successfully, this will become true.
@@ -123,6 +129,8 @@ namespace tgui
 
     void Picture::setPosition(float x, float y)
     {
+        markDirty();
+
         Transformable::setPosition(x, y);
 
         m_Texture.sprite.setPosition(x, y);
@@ -132,6 +140,8 @@ namespace tgui
 
     void Picture::setSize(float width, float height)
     {
+        markDirty();
+
         m_Size.x = width;
         m_Size.y = height;
 
@@ -145,6 +155,8 @@ namespace tgui
 
     void Picture::setSmooth(bool smooth)
     {
+        markDirty();
+
         if (m_Loaded)
             m_Texture.data->texture.setSmooth(smooth);
         else
@@ -169,6 +181,8 @@ namespace tgui
 
     void Picture::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         m_Texture.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -250,7 +264,9 @@ namespace tgui
 
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_Texture, states);
+        TGUI_PROFILE_ZONE("Picture::draw");
+
+        drawCounted(target, m_Texture, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <fstream>
+#include <vector>
+#include <atomic>
+
+#include <TGUI/Profiler.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    struct ProfileEvent
+    {
+        const char* name;
+        sf::Int64   start;
+        sf::Int64   duration;
+    };
+
+    // Every thread writes into its own buffer. Only that thread adds events, so it only has to publish the new count
+    // to make the events visible to the thread that saves the trace.
+    struct ProfileBuffer
+    {
+        static const unsigned int Capacity = 65536;
+
+        ProfileEvent              events[Capacity];
+        std::atomic<unsigned int> count;
+        unsigned int              threadId;
+    };
+
+    // The clock is created when the library is loaded, so that all threads use the same starting point
+    sf::Clock profileClock;
+
+    // The mutex is only locked when a thread records its first zone and when the trace is saved or cleared
+    sf::Mutex                          buffersMutex;
+    std::vector<ProfileBuffer*>        buffers;
+    sf::ThreadLocalPtr<ProfileBuffer>  threadBuffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isEnabled()
+    {
+#ifdef TGUI_ENABLE_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::saveChromeTrace(const std::string& filename)
+    {
+        if (!isEnabled())
+        {
+            TGUI_OUTPUT("TGUI error: Can't save the trace, tgui was build without TGUI_ENABLE_PROFILING.");
+            return false;
+        }
+
+        std::ofstream file(filename.c_str());
+        if (!file.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open " << filename << " to save the trace.");
+            return false;
+        }
+
+        file << "{\"traceEvents\":[";
+
+        bool first = true;
+        sf::Lock lock(buffersMutex);
+        for (std::vector<ProfileBuffer*>::const_iterator it = buffers.begin(); it != buffers.end(); ++it)
+        {
+            const ProfileBuffer& buffer = **it;
+
+            // Events that are added while saving are only included in the next trace
+            const unsigned int count = buffer.count.load(std::memory_order_acquire);
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                if (!first)
+                    file << ",";
+
+                file << "\n{\"name\":\"" << buffer.events[i].name << "\",\"cat\":\"tgui\",\"ph\":\"X\""
+                     << ",\"ts\":" << buffer.events[i].start << ",\"dur\":" << buffer.events[i].duration
+                     << ",\"pid\":1,\"tid\":" << buffer.threadId << "}";
+
+                first = false;
+            }
+        }
+
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return file.good();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::clear()
+    {
+        sf::Lock lock(buffersMutex);
+        for (std::vector<ProfileBuffer*>::iterator it = buffers.begin(); it != buffers.end(); ++it)
+            (*it)->count.store(0, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Int64 Profiler::getTime()
+    {
+        return profileClock.getElapsedTime().asMicroseconds();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::addZone(const char* name, sf::Int64 start, sf::Int64 end)
+    {
+        ProfileBuffer* buffer = threadBuffer;
+
+        // Create the buffer when this thread records its first zone.
+        // The buffers are never destroyed, so the zones of threads that already ended can still be saved.
+        if (!buffer)
+        {
+            buffer = new ProfileBuffer;
+            buffer->count.store(0, std::memory_order_relaxed);
+
+            sf::Lock lock(buffersMutex);
+            buffer->threadId = static_cast<unsigned int>(buffers.size()) + 1;
+            buffers.push_back(buffer);
+            threadBuffer = buffer;
+        }
+
+        const unsigned int count = buffer->count.load(std::memory_order_relaxed);
+        if (count == ProfileBuffer::Capacity)
+            return;
+
+        buffer->events[count].name = name;
+        buffer->events[count].start = start;
+        buffer->events[count].duration = end - start;
+        buffer->count.store(count + 1, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
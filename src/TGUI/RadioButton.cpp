@@ -25,6 +25,7 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/RadioButton.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -32,7 +33,8 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    RadioButton::RadioButton()
+    RadioButton::RadioButton() :
+    m_CustomGroup(false)
     {
         m_Callback.widgetType = Type_RadioButton;
     }
@@ -40,8 +42,20 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     RadioButton::RadioButton(const RadioButton& copy) :
-    Checkbox(copy)
+    Checkbox     (copy),
+    m_CustomGroup(copy.m_CustomGroup)
     {
+        // The copy only joins the group of a parent when it is added to a container
+        if (m_CustomGroup)
+            changeGroup(copy.m_Group);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButton::~RadioButton()
+    {
+        if (m_Group)
+            m_Group->radioButtonUnchecked(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +64,20 @@ namespace tgui
     {
         if (this != &right)
         {
+            // Leave the old group before the checked state changes
+            if (m_Group)
+            {
+                m_Group->radioButtonUnchecked(this);
+                m_Group.reset();
+            }
+
             this->Checkbox::operator=(right);
+
+            m_CustomGroup = right.m_CustomGroup;
+            if (m_CustomGroup)
+                changeGroup(right.m_Group);
+            else
+                joinParentGroup();
         }
 
         return *this;
@@ -67,6 +94,10 @@ namespace tgui
 
     bool RadioButton::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("RadioButton::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -180,10 +211,13 @@ namespace tgui
 
     void RadioButton::check()
     {
+        markDirty();
+
         if (m_Checked == false)
         {
-            // Tell our parent that all the radio buttons should be unchecked
-            m_Parent->uncheckRadioButtons();
+            // The group will uncheck the radio button that was checked before
+            if (m_Group)
+                m_Group->radioButtonChecked(this);
 
             // Check this radio button
             Checkbox::check();
@@ -201,7 +235,84 @@ namespace tgui
 
     void RadioButton::forceUncheck()
     {
-        Checkbox::uncheck();
+        if (m_Checked)
+        {
+            if (m_Group)
+                m_Group->radioButtonUnchecked(this);
+
+            Checkbox::uncheck();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::setGroup(const RadioButtonGroup::Ptr& group)
+    {
+        if (group)
+        {
+            m_CustomGroup = true;
+            changeGroup(group);
+        }
+        else
+        {
+            m_CustomGroup = false;
+            joinParentGroup();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButtonGroup::Ptr RadioButton::getGroup() const
+    {
+        return m_Group;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::joinParentGroup()
+    {
+        if (m_CustomGroup)
+            return;
+
+        if (m_Parent)
+            changeGroup(m_Parent->getRadioButtonGroup());
+        else
+            changeGroup(RadioButtonGroup::Ptr());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::leaveParentGroup()
+    {
+        if (!m_CustomGroup)
+            changeGroup(RadioButtonGroup::Ptr());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::initialize(Container *const container)
+    {
+        Checkbox::initialize(container);
+        joinParentGroup();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::changeGroup(const RadioButtonGroup::Ptr& group)
+    {
+        markDirty();
+
+        if (m_Group != group)
+        {
+            if (m_Group)
+                m_Group->radioButtonUnchecked(this);
+
+            m_Group = group;
+        }
+
+        // When a checked radio button joins a group, the radio button that was checked in that group gets unchecked
+        if (m_Group && m_Checked)
+            m_Group->radioButtonChecked(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
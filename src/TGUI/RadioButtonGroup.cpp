@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Container.hpp>
+#include <TGUI/RadioButton.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButtonGroup::RadioButtonGroup() :
+    m_CheckedRadioButton(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButtonGroup::Ptr RadioButtonGroup::create()
+    {
+        return Ptr(new RadioButtonGroup());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonGroup::uncheck()
+    {
+        // Unchecking the radio button will also reset m_CheckedRadioButton
+        if (m_CheckedRadioButton != nullptr)
+            m_CheckedRadioButton->forceUncheck();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButton* RadioButtonGroup::getCheckedRadioButton() const
+    {
+        return m_CheckedRadioButton;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonGroup::radioButtonChecked(RadioButton* radioButton)
+    {
+        if (m_CheckedRadioButton != radioButton)
+        {
+            uncheck();
+            m_CheckedRadioButton = radioButton;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonGroup::radioButtonUnchecked(RadioButton* radioButton)
+    {
+        if (m_CheckedRadioButton == radioButton)
+            m_CheckedRadioButton = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <iomanip>
+
+#include <SFML/OpenGL.hpp>
+
+#include <TGUI/RenderStats.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetTypeStats::WidgetTypeStats() :
+    widgets  (0),
+    drawCalls(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderStats::RenderStats()
+    {
+        reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStats::reset()
+    {
+        drawCalls = 0;
+        vertices = 0;
+        textureBinds = 0;
+        scissorChanges = 0;
+
+        widgetsVisited = 0;
+        widgetsCulled = 0;
+
+        handleEventTime = sf::Time::Zero;
+        updateTime = sf::Time::Zero;
+        drawTime = sf::Time::Zero;
+
+        widgetTypes.clear();
+
+        lastTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStats::addDrawCall(const sf::Texture* texture, unsigned int vertexCount)
+    {
+        ++drawCalls;
+        vertices += vertexCount;
+
+        if (texture != lastTexture)
+        {
+            ++textureBinds;
+            lastTexture = texture;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStats::addDrawable(const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        if (const sf::Sprite* sprite = dynamic_cast<const sf::Sprite*>(&drawable))
+        {
+            addDrawCall(sprite->getTexture(), 4);
+        }
+        else if (const sf::Text* text = dynamic_cast<const sf::Text*>(&drawable))
+        {
+            // Every character is drawn as a quad with the glyph texture of the font
+            if (text->getFont() != nullptr)
+                addDrawCall(&text->getFont()->getTexture(text->getCharacterSize()), text->getString().getSize() * 4);
+        }
+        else if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable))
+        {
+            // The inside is drawn as a triangle fan and the outline as a triangle strip
+            addDrawCall(shape->getTexture(), shape->getPointCount() + 2);
+
+            if (shape->getOutlineThickness() != 0)
+                addDrawCall(nullptr, (shape->getPointCount() + 1) * 2);
+        }
+        else if (const sf::VertexArray* vertexArray = dynamic_cast<const sf::VertexArray*>(&drawable))
+        {
+            addDrawCall(states.texture, vertexArray->getVertexCount());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* RenderStats::getTypeName(WidgetTypes type)
+    {
+        switch (type)
+        {
+            case Type_ClickableWidget: return "ClickableWidget";
+            case Type_Picture:         return "Picture";
+            case Type_Button:          return "Button";
+            case Type_Checkbox:        return "Checkbox";
+            case Type_RadioButton:     return "RadioButton";
+            case Type_Label:           return "Label";
+            case Type_EditBox:         return "EditBox";
+            case Type_ListBox:         return "ListBox";
+            case Type_ComboBox:        return "ComboBox";
+            case Type_Slider:          return "Slider";
+            case Type_Scrollbar:       return "Scrollbar";
+            case Type_LoadingBar:      return "LoadingBar";
+            case Type_TextBox:         return "TextBox";
+            case Type_SpriteSheet:     return "SpriteSheet";
+            case Type_AnimatedPicture: return "AnimatedPicture";
+            case Type_SpinButton:      return "SpinButton";
+            case Type_Slider2d:        return "Slider2d";
+            case Type_Tab:             return "Tab";
+            case Type_MenuBar:         return "MenuBar";
+            case Type_ChatBox:         return "ChatBox";
+            case Type_Panel:           return "Panel";
+            case Type_ChildWindow:     return "ChildWindow";
+            case Type_Grid:            return "Grid";
+            case Type_MessageBox:      return "MessageBox";
+            default:                   return "Unknown";
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderStatsOverlay::RenderStatsOverlay()
+    {
+        m_Text.setCharacterSize(12);
+        m_Text.setColor(sf::Color::White);
+        m_Text.setPosition(4, 2);
+
+        m_Background.setFillColor(sf::Color(0, 0, 0, 180));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStatsOverlay::setTextFont(const sf::Font& font)
+    {
+        m_Text.setFont(font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStatsOverlay::setStats(const RenderStats& stats)
+    {
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(2);
+
+        text << "Draw calls: " << stats.drawCalls << "\n"
+             << "Vertices: " << stats.vertices << "\n"
+             << "Texture binds: " << stats.textureBinds << "\n"
+             << "Scissor changes: " << stats.scissorChanges << "\n"
+             << "Widgets visited: " << stats.widgetsVisited << "\n"
+             << "Widgets culled: " << stats.widgetsCulled << "\n"
+             << "handleEvent: " << stats.handleEventTime.asMicroseconds() / 1000.f << " ms\n"
+             << "updateTime: " << stats.updateTime.asMicroseconds() / 1000.f << " ms\n"
+             << "draw: " << stats.drawTime.asMicroseconds() / 1000.f << " ms\n";
+
+        for (std::map<WidgetTypes, WidgetTypeStats>::const_iterator it = stats.widgetTypes.begin(); it != stats.widgetTypes.end(); ++it)
+        {
+            text << "\n" << RenderStats::getTypeName(it->first) << ": " << it->second.widgets << " widgets, "
+                 << it->second.drawCalls << " draw calls, " << it->second.drawTime.asMicroseconds() / 1000.f << " ms";
+        }
+
+        m_Text.setString(text.str());
+
+        sf::FloatRect bounds = m_Text.getLocalBounds();
+        m_Background.setSize(sf::Vector2f(bounds.left + bounds.width + 12, bounds.top + bounds.height + 10));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStatsOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        // The overlay is always drawn in the top left corner of the target, no matter which view is being used
+        sf::View oldView = target.getView();
+        target.setView(target.getDefaultView());
+
+        target.draw(m_Background, states);
+        target.draw(m_Text, states);
+
+        target.setView(oldView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void drawCounted(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        if (TGUI_RenderStats)
+            TGUI_RenderStats->addDrawable(drawable, states);
+
+        target.draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setScissor(int x, int y, int width, int height)
+    {
+        if (TGUI_RenderStats)
+            ++TGUI_RenderStats->scissorChanges;
+
+        glScissor(x, y, width, height);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
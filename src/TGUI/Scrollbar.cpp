@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Scrollbar.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /// \todo Support SplitImage.
 /// \todo Arrow images should be allowed to point left and right. This will mess up most calculations.
@@ -101,6 +103,10 @@ namespace tgui
 
     bool Scrollbar::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Scrollbar::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -347,6 +353,8 @@ namespace tgui
 
     void Scrollbar::setMinimum(unsigned int)
     {
+        markDirty();
+
         // Do nothing. The minimum may not be changed.
     }
 
@@ -354,6 +362,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        markDirty();
+
         Slider::setMaximum(maximum);
 
         // When the value is above the maximum then adjust it
@@ -369,6 +379,8 @@ namespace tgui
     {
         if (m_Value != value)
         {
+            markDirty();
+
             // Set the new value
             m_Value = value;
 
@@ -392,6 +404,8 @@ namespace tgui
 
     void Scrollbar::setLowValue(unsigned int lowValue)
     {
+        markDirty();
+
         // Set the new value
         m_LowValue = lowValue;
 
@@ -413,6 +427,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        markDirty();
+
         m_AutoHide = autoHide;
     }
 
@@ -427,6 +443,8 @@ namespace tgui
 
     void Scrollbar::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Slider::setTransparency(transparency);
 
         m_TextureArrowUpNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -540,6 +558,8 @@ namespace tgui
 
     void Scrollbar::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         m_MouseDown = true;
         m_MouseDownOnArrow = false;
 
@@ -594,6 +614,8 @@ namespace tgui
 
     void Scrollbar::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         // Check if one of the arrows was clicked
         if ((m_MouseDown) && (m_MouseDownOnArrow))
         {
@@ -888,6 +910,8 @@ namespace tgui
 
     void Scrollbar::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Scrollbar::draw");
+
         // If the scrollbar wasn't loaded then don't draw it
         if (m_Loaded == false)
             return;
@@ -927,16 +951,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                drawCounted(target, m_TextureTrackHover_M, states);
             else
-                target.draw(m_TextureTrackNormal_M, states);
+                drawCounted(target, m_TextureTrackNormal_M, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureTrackNormal_M, states);
+            drawCounted(target, m_TextureTrackNormal_M, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                drawCounted(target, m_TextureTrackHover_M, states);
         }
 
         // Reset the transformation (in case there was any rotation)
@@ -955,16 +979,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        drawCounted(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
 
                 // Calculate the real track height (height without the arrows)
@@ -994,16 +1018,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        drawCounted(target, m_TextureThumbHover, states);
                     else
-                        target.draw(m_TextureThumbNormal, states);
+                        drawCounted(target, m_TextureThumbNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureThumbNormal, states);
+                    drawCounted(target, m_TextureThumbNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        drawCounted(target, m_TextureThumbHover, states);
                 }
 
                 // Reset the transformation
@@ -1024,16 +1048,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        drawCounted(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
 
                 // Reset the transformation
@@ -1050,16 +1074,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    drawCounted(target, m_TextureArrowUpHover, states);
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    drawCounted(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                drawCounted(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    drawCounted(target, m_TextureArrowUpHover, states);
             }
         }
         else // The scrollbar lies horizontal
@@ -1077,16 +1101,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        drawCounted(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
 
                 // Calculate the real track width (width without the arrows)
@@ -1116,16 +1140,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        drawCounted(target, m_TextureThumbHover, states);
                     else
-                        target.draw(m_TextureThumbNormal, states);
+                        drawCounted(target, m_TextureThumbNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureThumbNormal, states);
+                    drawCounted(target, m_TextureThumbNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        drawCounted(target, m_TextureThumbHover, states);
                 }
 
                 // Reset the transformation
@@ -1149,16 +1173,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        drawCounted(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
 
                 // Reset the transformation
@@ -1178,16 +1202,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    drawCounted(target, m_TextureArrowUpHover, states);
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    drawCounted(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                drawCounted(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    drawCounted(target, m_TextureArrowUpHover, states);
             }
         }
     }
@@ -25,6 +25,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Slider.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -61,7 +63,9 @@ namespace tgui
     m_SplitImage         (copy.m_SplitImage),
     m_SeparateHoverImage (copy.m_SeparateHoverImage),
     m_Size               (copy.m_Size),
-    m_ThumbSize          (copy.m_ThumbSize)
+    m_ThumbSize          (copy.m_ThumbSize),
+    m_SpriteTrackNormal  (copy.m_SpriteTrackNormal),
+    m_SpriteTrackHover   (copy.m_SpriteTrackHover)
     {
 
         // Copy the textures
@@ -118,6 +122,8 @@ namespace tgui
             std::swap(m_TextureTrackHover_M,  temp.m_TextureTrackHover_M);
             std::swap(m_TextureTrackNormal_R, temp.m_TextureTrackNormal_R);
             std::swap(m_TextureTrackHover_R,  temp.m_TextureTrackHover_R);
+            std::swap(m_SpriteTrackNormal,    temp.m_SpriteTrackNormal);
+            std::swap(m_SpriteTrackHover,     temp.m_SpriteTrackHover);
             std::swap(m_TextureThumbNormal,   temp.m_TextureThumbNormal);
             std::swap(m_TextureThumbHover,    temp.m_TextureThumbHover);
         }
@@ -136,6 +142,10 @@ namespace tgui
 
     bool Slider::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Slider::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -295,6 +305,8 @@ namespace tgui
 
                 // Set the thumb size
                 m_ThumbSize = sf::Vector2f(m_TextureThumbNormal.getSize());
+
+                m_SpriteTrackNormal.setTextures(m_TextureTrackNormal_L, m_TextureTrackNormal_M, m_TextureTrackNormal_R, m_VerticalImage);
             }
             else
             {
@@ -307,6 +319,7 @@ namespace tgui
              && (m_TextureTrackHover_R.data != nullptr) && (m_TextureThumbHover.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
+                m_SpriteTrackHover.setTextures(m_TextureTrackHover_L, m_TextureTrackHover_M, m_TextureTrackHover_R, m_VerticalImage);
             }
         }
         else // The image isn't split
@@ -347,6 +360,8 @@ namespace tgui
 
     void Slider::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -402,6 +417,8 @@ namespace tgui
 
     void Slider::setMinimum(unsigned int minimum)
     {
+        markDirty();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -418,6 +435,8 @@ namespace tgui
 
     void Slider::setMaximum(unsigned int maximum)
     {
+        markDirty();
+
         // Set the new maximum
         if (maximum > 0)
             m_Maximum = maximum;
@@ -439,6 +458,8 @@ namespace tgui
     {
         if (m_Value != value)
         {
+            markDirty();
+
             // Set the new value
             m_Value = value;
 
@@ -462,6 +483,8 @@ namespace tgui
 
     void Slider::setVerticalScroll(bool verticalScroll)
     {
+        markDirty();
+
         // Only continue when the value changed
         if (m_VerticalScroll != verticalScroll)
         {
@@ -542,14 +565,14 @@ namespace tgui
 
     void Slider::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
-        m_TextureTrackNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureTrackHover_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureTrackNormal_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureTrackHover_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureTrackNormal_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureTrackHover_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+        m_SpriteTrackNormal.setColor(sf::Color(255, 255, 255, m_Opacity));
+        m_SpriteTrackHover.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureThumbNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureThumbHover.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
     }
@@ -620,6 +643,8 @@ namespace tgui
 
     void Slider::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         m_MouseDown = true;
 
         // Refresh the value
@@ -630,6 +655,9 @@ namespace tgui
 
     void Slider::leftMouseReleased(float, float)
     {
+        if (m_MouseDown)
+            markDirty();
+
         m_MouseDown = false;
     }
 
@@ -788,6 +816,8 @@ namespace tgui
 
     void Slider::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Slider::draw");
+
         // Don't draw when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -803,137 +833,41 @@ namespace tgui
         // Check if the image is split
         if (m_SplitImage)
         {
-            // Get the scale factors
+            // The sprites lie in the direction of the image, so they have to be rotated when the slider lies in the other direction
             if (m_VerticalScroll == m_VerticalImage)
             {
-                scaling.x = m_Size.x / (m_TextureTrackNormal_L.getSize().x + m_TextureTrackNormal_M.getSize().x + m_TextureTrackNormal_R.getSize().x);
-                scaling.y = m_Size.y / m_TextureTrackNormal_M.getSize().y;
+                m_SpriteTrackNormal.setSize(m_Size.x, m_Size.y);
+                m_SpriteTrackHover.setSize(m_Size.x, m_Size.y);
             }
             else
             {
-                // Check in what direction the slider should rotate
+                m_SpriteTrackNormal.setSize(m_Size.y, m_Size.x);
+                m_SpriteTrackHover.setSize(m_Size.y, m_Size.x);
+
+                // Set the rotation
                 if ((m_VerticalImage == true) && (m_VerticalScroll == false))
-                {
-                    // Set the rotation
-                    states.transform.rotate(-90,
-                                            (m_TextureTrackNormal_L.getSize().x + m_TextureTrackNormal_M.getSize().x + m_TextureTrackNormal_R.getSize().x) * 0.5f,
-                                            m_TextureTrackNormal_M.getSize().x * 0.5f);
-                }
+                    states.transform.rotate(-90, m_Size.y * 0.5f, m_Size.y * 0.5f);
                 else // if ((m_VerticalImage == false) && (m_VerticalScroll == true))
-                {
-                    // Set the rotation
-                    states.transform.rotate(90,
-                                            (m_TextureTrackNormal_L.getSize().y + m_TextureTrackNormal_M.getSize().y + m_TextureTrackNormal_R.getSize().y) * 0.5f,
-                                            m_TextureTrackNormal_M.getSize().y * 0.5f);
-                }
-
-                scaling.x = m_Size.x / (m_TextureTrackNormal_L.getSize().y + m_TextureTrackNormal_M.getSize().y + m_TextureTrackNormal_R.getSize().y);
-                scaling.y = m_Size.y / m_TextureTrackNormal_M.getSize().x;
+                    states.transform.rotate(90, m_Size.x * 0.5f, m_Size.x * 0.5f);
             }
 
-            // Set the scale for the left image
-            states.transform.scale(scaling.y, scaling.y);
-
-            // Draw the left image
+            // Check if there is a separate hover image
+            if (m_SeparateHoverImage)
             {
-                // Check if there is a separate hover image
-                if (m_SeparateHoverImage)
-                {
-                    // Draw the correct image
-                    if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureTrackHover_L, states);
-                    else
-                        target.draw(m_TextureTrackNormal_L, states);
-                }
+                // Draw the correct image
+                if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
+                    drawCounted(target, m_SpriteTrackHover, states);
                 else
-                {
-                    // Draw the normal track image
-                    target.draw(m_TextureTrackNormal_L, states);
-
-                    // When the mouse is on top of the slider then draw the hover image
-                    if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureTrackHover_L, states);
-                }
-
-                // When the slider is focused then draw an extra image
-//                if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-//                    target.draw(m_SpriteFocused_L, states);
+                    drawCounted(target, m_SpriteTrackNormal, states);
             }
-
-            // Check if the middle image may be drawn
-            if ((scaling.y * (m_TextureTrackNormal_L.getSize().x + m_TextureTrackNormal_R.getSize().x))
-                < scaling.x * (m_TextureTrackNormal_L.getSize().x + m_TextureTrackNormal_M.getSize().x + m_TextureTrackNormal_R.getSize().x))
-            {
-                // Calculate the scale for our middle image
-                float scaleX = (((m_TextureTrackNormal_L.getSize().x + m_TextureTrackNormal_M.getSize().x + m_TextureTrackNormal_R.getSize().x)  * scaling.x)
-                                 - ((m_TextureTrackNormal_L.getSize().x + m_TextureTrackNormal_R.getSize().x) * scaling.y))
-                               / m_TextureTrackNormal_M.getSize().x;
-
-                // Put the middle image on the correct position
-                states.transform.translate(static_cast<float>(m_TextureTrackNormal_L.getSize().x), 0);
-
-                // Set the scale for the middle image
-                states.transform.scale(scaleX / scaling.y, 1);
-
-                // Draw the middle image
-                {
-                    // Check if there is a separate hover image
-                    if (m_SeparateHoverImage)
-                    {
-                        // Draw the correct image
-                        if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                            target.draw(m_TextureTrackHover_M, states);
-                        else
-                            target.draw(m_TextureTrackNormal_M, states);
-                    }
-                    else
-                    {
-                        // Draw the normal track image
-                        target.draw(m_TextureTrackNormal_M, states);
-
-                        // When the mouse is on top of the slider then draw the hover image
-                        if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                            target.draw(m_TextureTrackHover_M, states);
-                    }
-
-                    // When the slider is focused then draw an extra image
-//                    if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-//                        target.draw(m_SpriteFocused_M, states);
-                }
-
-                // Put the right image on the correct position
-                states.transform.translate(static_cast<float>(m_TextureTrackNormal_M.getSize().x), 0);
-
-                // Set the scale for the right image
-                states.transform.scale(scaling.y / scaleX, 1);
-            }
-            else // The middle image is not drawn
-                states.transform.translate(static_cast<float>(m_TextureTrackNormal_L.getSize().x), 0);
-
-            // Draw the right image
+            else
             {
-                // Check if there is a separate hover image
-                if (m_SeparateHoverImage)
-                {
-                    // Draw the correct image
-                    if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureTrackHover_R, states);
-                    else
-                        target.draw(m_TextureTrackNormal_R, states);
-                }
-                else
-                {
-                    // Draw the normal track image
-                    target.draw(m_TextureTrackNormal_R, states);
-
-                    // When the mouse is on top of the slider then draw the hover image
-                    if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureTrackHover_R, states);
-                }
+                // Draw the normal track image
+                drawCounted(target, m_SpriteTrackNormal, states);
 
-                // When the slider is focused then draw an extra image
-//                if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-//                    target.draw(m_SpriteFocused_R, states);
+                // When the mouse is on top of the slider then draw the hover image
+                if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
+                    drawCounted(target, m_SpriteTrackHover, states);
             }
         }
         else // The image is not split
@@ -960,11 +894,11 @@ namespace tgui
             }
 
             // Draw the normal track image
-            target.draw(m_TextureTrackNormal_M, states);
+            drawCounted(target, m_TextureTrackNormal_M, states);
 
             // When the mouse is on top of the slider then draw the hover image
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                drawCounted(target, m_TextureTrackHover_M, states);
         }
 
         // Reset the transform
@@ -1003,11 +937,11 @@ namespace tgui
         }
 
         // Draw the normal thumb image
-        target.draw(m_TextureThumbNormal, states);
+        drawCounted(target, m_TextureThumbNormal, states);
 
         // When the mouse is on top of the slider then draw the hover image
         if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-            target.draw(m_TextureThumbHover, states);
+            drawCounted(target, m_TextureThumbHover, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
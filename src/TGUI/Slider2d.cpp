@@ -27,6 +27,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Slider2d.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -112,6 +114,10 @@ namespace tgui
 
     bool Slider2d::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Slider2d::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -227,6 +233,8 @@ namespace tgui
 
     void Slider2d::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -244,6 +252,8 @@ namespace tgui
 
     void Slider2d::setMinimum(const sf::Vector2f& minimum)
     {
+        markDirty();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -264,6 +274,8 @@ namespace tgui
 
     void Slider2d::setMaximum(const sf::Vector2f& maximum)
     {
+        markDirty();
+
         // Set the new maximum
         m_Maximum = maximum;
 
@@ -284,6 +296,8 @@ namespace tgui
 
     void Slider2d::setValue(const sf::Vector2f& value)
     {
+        const sf::Vector2f oldValue = m_Value;
+
         // Set the new value
         m_Value = value;
 
@@ -297,6 +311,9 @@ namespace tgui
             m_Value.y = m_Minimum.y;
         else if (m_Value.y > m_Maximum.y)
             m_Value.y = m_Maximum.y;
+
+        if (m_Value != oldValue)
+            markDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,6 +341,8 @@ namespace tgui
 
     void Slider2d::setFixedThumbSize(bool fixedSize)
     {
+        markDirty();
+
         m_FixedThumbSize = fixedSize;
     }
 
@@ -338,6 +357,8 @@ namespace tgui
 
     void Slider2d::enableThumbCenter(bool autoCenterThumb)
     {
+        markDirty();
+
         m_ReturnThumbToCenter = autoCenterThumb;
     }
 
@@ -345,6 +366,8 @@ namespace tgui
 
     void Slider2d::centerThumb()
     {
+        markDirty();
+
         setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
     }
 
@@ -352,6 +375,8 @@ namespace tgui
 
     void Slider2d::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureThumbNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -364,6 +389,8 @@ namespace tgui
 
     void Slider2d::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         ClickableWidget::leftMousePressed(x, y);
 
         // Refresh the value
@@ -374,6 +401,8 @@ namespace tgui
 
     void Slider2d::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         ClickableWidget::leftMouseReleased(x, y);
 
         if (m_ReturnThumbToCenter)
@@ -412,20 +441,22 @@ namespace tgui
         // Check if the mouse button is down
         if (m_MouseDown)
         {
+            sf::Vector2f value;
+
             // If the position is positive then calculate the correct value
             if ((y - position.y) > 0)
-                m_Value.y = ((y - position.y) / m_Size.y) * (m_Maximum.y - m_Minimum.y) + m_Minimum.y;
+                value.y = ((y - position.y) / m_Size.y) * (m_Maximum.y - m_Minimum.y) + m_Minimum.y;
             else // The position is negative, the calculation can't be done (but is not needed)
-                m_Value.y = m_Minimum.y;
+                value.y = m_Minimum.y;
 
             // If the position is positive then calculate the correct value
             if ((x - position.x) > 0)
-                m_Value.x = ((x - position.x) / m_Size.x) * (m_Maximum.x - m_Minimum.x) + m_Minimum.x;
+                value.x = ((x - position.x) / m_Size.x) * (m_Maximum.x - m_Minimum.x) + m_Minimum.x;
             else // The position is negative, the calculation can't be done (but is not needed)
-                m_Value.x = m_Minimum.x;
+                value.x = m_Minimum.x;
 
             // Set the new value, making sure that it lies within the minimum and maximum
-            setValue(m_Value);
+            setValue(value);
 
             // Add the callback (if the user requested it)
             if ((oldValue != m_Value) && (m_CallbackFunctions[ValueChanged].empty() == false))
@@ -596,6 +627,8 @@ namespace tgui
 
     void Slider2d::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Slider2d::draw");
+
         // Don't draw when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -623,16 +656,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover, states);
+                drawCounted(target, m_TextureTrackHover, states);
             else
-                target.draw(m_TextureTrackNormal, states);
+                drawCounted(target, m_TextureTrackNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureTrackNormal, states);
+            drawCounted(target, m_TextureTrackNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover, states);
+                drawCounted(target, m_TextureTrackHover, states);
         }
 
         // Undo the scale
@@ -670,26 +703,26 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Draw the thumb image
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureThumbHover, states);
+                drawCounted(target, m_TextureThumbHover, states);
             else
-                target.draw(m_TextureThumbNormal, states);
+                drawCounted(target, m_TextureThumbNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureThumbNormal, states);
+            drawCounted(target, m_TextureThumbNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureThumbHover, states);
+                drawCounted(target, m_TextureThumbHover, states);
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
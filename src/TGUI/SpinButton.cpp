@@ -25,6 +25,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/SpinButton.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /// \todo Allow images next to each other (e.g. plus and minus icon).
 
@@ -113,6 +115,10 @@ namespace tgui
 
     bool SpinButton::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("SpinButton::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -228,6 +234,8 @@ namespace tgui
 
     void SpinButton::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the spin button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -245,6 +253,8 @@ namespace tgui
 
     void SpinButton::setMinimum(unsigned int minimum)
     {
+        markDirty();
+
         // Set the new minimum
         m_Minimum = minimum;
 
@@ -261,6 +271,8 @@ namespace tgui
 
     void SpinButton::setMaximum(unsigned int maximum)
     {
+        markDirty();
+
         m_Maximum = maximum;
 
         // The maximum can never be below the minimum
@@ -276,6 +288,8 @@ namespace tgui
 
     void SpinButton::setValue(unsigned int value)
     {
+        markDirty();
+
         // Set the new value
         m_Value = value;
 
@@ -311,6 +325,8 @@ namespace tgui
 
     void SpinButton::setVerticalScroll(bool verticalScroll)
     {
+        markDirty();
+
         m_VerticalScroll = verticalScroll;
     }
 
@@ -325,6 +341,8 @@ namespace tgui
 
     void SpinButton::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         ClickableWidget::setTransparency(transparency);
 
         m_TextureArrowUpNormal.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
@@ -337,6 +355,8 @@ namespace tgui
 
     void SpinButton::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         m_MouseDown = true;
 
         // Check if the mouse is on top of the upper/right arrow
@@ -360,6 +380,8 @@ namespace tgui
 
     void SpinButton::leftMouseReleased(float x, float y)
     {
+        markDirty();
+
         // Check if the mouse went down on the spin button
         if (m_MouseDown)
         {
@@ -411,6 +433,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(float x, float y)
     {
+        const bool oldMouseHoverOnTopArrow = m_MouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_VerticalScroll)
         {
@@ -427,6 +451,10 @@ namespace tgui
                 m_MouseHoverOnTopArrow = true;
         }
 
+        // The hovered arrow is drawn differently
+        if (m_MouseHoverOnTopArrow != oldMouseHoverOnTopArrow)
+            markDirty();
+
         if (m_MouseHover == false)
             mouseEnteredWidget();
 
@@ -508,6 +536,8 @@ namespace tgui
 
     void SpinButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("SpinButton::draw");
+
         // Don't draw when the spin button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -526,19 +556,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                drawCounted(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
             }
 
@@ -551,19 +581,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        drawCounted(target, m_TextureArrowDownHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    drawCounted(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                drawCounted(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (!m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        drawCounted(target, m_TextureArrowDownHover, states);
                 }
             }
         }
@@ -583,19 +613,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    drawCounted(target, m_TextureArrowUpNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                drawCounted(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (!m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        drawCounted(target, m_TextureArrowUpHover, states);
                 }
             }
 
@@ -608,19 +638,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        drawCounted(target, m_TextureArrowDownHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    drawCounted(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                drawCounted(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        drawCounted(target, m_TextureArrowDownHover, states);
                 }
             }
         }
@@ -78,6 +78,8 @@ namespace tgui
 
     void SpriteSheet::setSize(float width, float height)
     {
+        markDirty();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -108,6 +110,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // You can't have 0 rows
         if (rows == 0)
             rows = 1;
@@ -166,6 +170,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // You can't make a row visible that doesn't exist
         if (row > m_Rows)
             row = m_Rows;
@@ -31,8 +31,14 @@ namespace tgui
 {
     TextureManager TGUI_TextureManager;
 
+    FontManager TGUI_FontManager;
+
+    TextMeasurementCache TGUI_TextMeasurementCache;
+
     bool tabKeyUsageEnabled = true;
 
+    RenderStats* TGUI_RenderStats = nullptr;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::Color extractColor(std::string string)
@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Tab.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /// \todo  Cache size to speedup getSize function.
 
@@ -64,6 +66,8 @@ namespace tgui
     m_SelectedTab          (copy.m_SelectedTab),
     m_TabNames             (copy.m_TabNames),
     m_NameWidth            (copy.m_NameWidth),
+    m_SpriteNormal         (copy.m_SpriteNormal),
+    m_SpriteSelected       (copy.m_SpriteSelected),
     m_Text                 (copy.m_Text)
     {
         TGUI_TextureManager.copyTexture(copy.m_TextureNormal_L, m_TextureNormal_L);
@@ -114,6 +118,8 @@ namespace tgui
             std::swap(m_TextureSelected_L,     temp.m_TextureSelected_L);
             std::swap(m_TextureSelected_M,     temp.m_TextureSelected_M);
             std::swap(m_TextureSelected_R,     temp.m_TextureSelected_R);
+            std::swap(m_SpriteNormal,          temp.m_SpriteNormal);
+            std::swap(m_SpriteSelected,        temp.m_SpriteSelected);
             std::swap(m_Text,                  temp.m_Text);
         }
 
@@ -131,6 +137,10 @@ namespace tgui
 
     bool Tab::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("Tab::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -271,6 +281,7 @@ namespace tgui
             if ((m_TextureNormal_L.data != nullptr) && (m_TextureNormal_M.data != nullptr) && (m_TextureNormal_R.data != nullptr))
             {
                 m_TabHeight = m_TextureNormal_M.getSize().y;
+                m_SpriteNormal.setTextures(m_TextureNormal_L, m_TextureNormal_M, m_TextureNormal_R);
             }
             else
             {
@@ -282,6 +293,7 @@ namespace tgui
             if ((m_TextureSelected_L.data != nullptr) && (m_TextureSelected_M.data != nullptr) && (m_TextureSelected_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Selected;
+                m_SpriteSelected.setTextures(m_TextureSelected_L, m_TextureSelected_M, m_TextureSelected_R);
             }
         }
         else // The image isn't split
@@ -350,12 +362,14 @@ namespace tgui
 
     unsigned int Tab::add(const sf::String& name, bool selectTab)
     {
+        markDirty();
+
         // Add the tab
         m_TabNames.push_back(name);
 
         // Calculate the width of the tab
         m_Text.setString(name);
-        m_NameWidth.push_back(m_Text.getLocalBounds().width);
+        m_NameWidth.push_back(TGUI_TextMeasurementCache.getLocalBounds(m_Text).width);
 
         // If the tab has to be selected then do so
         if (selectTab)
@@ -376,7 +390,12 @@ namespace tgui
             if (m_TabNames[i] == name)
             {
                 // Select the tab
-                m_SelectedTab = i;
+                if (m_SelectedTab != static_cast<int>(i))
+                {
+                    markDirty();
+                    m_SelectedTab = i;
+                }
+
                 return;
             }
         }
@@ -396,13 +415,20 @@ namespace tgui
         }
 
         // Select the tab
-        m_SelectedTab = index;
+        if (m_SelectedTab != static_cast<int>(index))
+        {
+            markDirty();
+            m_SelectedTab = index;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Tab::deselect()
     {
+        if (m_SelectedTab != -1)
+            markDirty();
+
         m_SelectedTab = -1;
     }
 
@@ -416,6 +442,8 @@ namespace tgui
             // Check if you found the tab to remove
             if (m_TabNames[i] == name)
             {
+                markDirty();
+
                 // Remove the tab
                 m_TabNames.erase(m_TabNames.begin() + i);
                 m_NameWidth.erase(m_NameWidth.begin() + i);
@@ -444,6 +472,8 @@ namespace tgui
             return;
         }
 
+        markDirty();
+
         // Remove the tab
         m_TabNames.erase(m_TabNames.begin() + index);
         m_NameWidth.erase(m_NameWidth.begin() + index);
@@ -459,6 +489,8 @@ namespace tgui
 
     void Tab::removeAll()
     {
+        markDirty();
+
         m_TabNames.clear();
         m_NameWidth.clear();
         m_SelectedTab = -1;
@@ -485,6 +517,8 @@ namespace tgui
 
     void Tab::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_Text.setFont(font);
     }
 
@@ -499,6 +533,8 @@ namespace tgui
 
     void Tab::setTextColor(const sf::Color& color)
     {
+        markDirty();
+
         m_Text.setColor(color);
     }
 
@@ -513,6 +549,8 @@ namespace tgui
 
     void Tab::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Change the text size
         m_TextSize = size;
 
@@ -522,7 +560,7 @@ namespace tgui
             // Calculate the text size
             m_Text.setString("kg");
             m_Text.setCharacterSize(static_cast<unsigned int>(m_TabHeight * 0.85f));
-            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - m_Text.getLocalBounds().top));
+            m_Text.setCharacterSize(static_cast<unsigned int>(m_Text.getCharacterSize() - TGUI_TextMeasurementCache.getLocalBounds(m_Text).top));
         }
         else // When the text has a fixed size
         {
@@ -534,7 +572,7 @@ namespace tgui
         for (unsigned int i=0; i<m_NameWidth.size(); ++i)
         {
             m_Text.setString(m_TabNames[i]);
-            m_NameWidth[i] = m_Text.getLocalBounds().width;
+            m_NameWidth[i] = TGUI_TextMeasurementCache.getLocalBounds(m_Text).width;
         }
     }
 
@@ -549,6 +587,8 @@ namespace tgui
 
     void Tab::setTabHeight(unsigned int height)
     {
+        markDirty();
+
         // Make sure that the height changed
         if (m_TabHeight != height)
         {
@@ -571,6 +611,8 @@ namespace tgui
 
     void Tab::setMaximumTabWidth(unsigned int maximumWidth)
     {
+        markDirty();
+
         m_MaximumTabWidth = maximumWidth;
     }
 
@@ -585,6 +627,8 @@ namespace tgui
 
     void Tab::setDistanceToSide(unsigned int distanceToSide)
     {
+        markDirty();
+
         m_DistanceToSide = distanceToSide;
     }
 
@@ -599,14 +643,14 @@ namespace tgui
 
     void Tab::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
-        m_TextureNormal_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureNormal_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureNormal_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureSelected_L.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
         m_TextureSelected_M.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
-        m_TextureSelected_R.sprite.setColor(sf::Color(255, 255, 255, m_Opacity));
+        m_SpriteNormal.setColor(sf::Color(255, 255, 255, m_Opacity));
+        m_SpriteSelected.setColor(sf::Color(255, 255, 255, m_Opacity));
 
         m_Text.setColor(sf::Color(m_Text.getColor().r, m_Text.getColor().g, m_Text.getColor().b, m_Opacity));
     }
@@ -633,6 +677,8 @@ namespace tgui
 
     void Tab::leftMousePressed(float x, float y)
     {
+        markDirty();
+
         float width = getPosition().x;
 
         // Loop through all tabs
@@ -744,6 +790,8 @@ namespace tgui
 
     void Tab::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("Tab::draw");
+
         // Don't draw when the child window wasn't created
         if (m_Loaded == false)
             return;
@@ -768,7 +816,7 @@ namespace tgui
 
         // Calculate the height and top of all strings
         tempText.setString("kg");
-        defaultRect = tempText.getLocalBounds();
+        defaultRect = TGUI_TextMeasurementCache.getLocalBounds(tempText);
 
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
@@ -799,105 +847,25 @@ namespace tgui
                 if (tabWidth < minimumWidth)
                     tabWidth = static_cast<unsigned int>(minimumWidth);
 
-                // Set the scaling
-                states.transform.scale(scalingY, scalingY);
+                // Give the sprites the width of this tab
+                m_SpriteNormal.setSize(static_cast<float>(tabWidth), static_cast<float>(m_TabHeight));
+                m_SpriteSelected.setSize(static_cast<float>(tabWidth), static_cast<float>(m_TabHeight));
 
-                // Draw the left tab image
+                // Draw the tab image
                 if (m_SeparateSelectedImage)
                 {
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_L, states);
+                        drawCounted(target, m_SpriteSelected, states);
                     else
-                        target.draw(m_TextureNormal_L, states);
+                        drawCounted(target, m_SpriteNormal, states);
                 }
                 else // There is no separate selected image
                 {
-                    target.draw(m_TextureNormal_L, states);
+                    drawCounted(target, m_SpriteNormal, states);
 
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_L, states);
-                }
-
-                // Check if the middle image may be drawn
-                if ((scalingY * (m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x)) < tabWidth)
-                {
-                    // Calculate the scale for our middle image
-                    float scaleX = (tabWidth / static_cast<float>(m_TextureNormal_M.getSize().x)) - (((m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x) * scalingY) / m_TextureNormal_M.getSize().x);
-
-                    // Put the middle image on the correct position
-                    states.transform.translate(static_cast<float>(m_TextureNormal_L.getSize().x), 0);
-
-                    // Set the scale for the middle image
-                    states.transform.scale(scaleX / scalingY, 1);
-
-                    // Draw the middle tab image
-                    if (m_SeparateSelectedImage)
-                    {
-                        if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_M, states);
-                        else
-                            target.draw(m_TextureNormal_M, states);
-                    }
-                    else // There is no separate selected image
-                    {
-                        target.draw(m_TextureNormal_M, states);
-
-                        if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_M, states);
-                    }
-
-                    // Put the right image on the correct position
-                    states.transform.translate(static_cast<float>(m_TextureNormal_M.getSize().x), 0);
-
-                    // Set the scale for the right image
-                    states.transform.scale(scalingY / scaleX, 1);
-
-                    // Draw the right tab image
-                    if (m_SeparateSelectedImage)
-                    {
-                        if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
-                        else
-                            target.draw(m_TextureNormal_R, states);
-                    }
-                    else // There is no separate selected image
-                    {
-                        target.draw(m_TextureNormal_R, states);
-
-                        if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
-                    }
-
-                    // Undo the translation
-                    states.transform.translate(-(m_TextureNormal_L.getSize().x + (m_TextureNormal_M.getSize().x * scaleX / scalingY)), 0);
+                        drawCounted(target, m_SpriteSelected, states);
                 }
-                else // The edit box isn't width enough, we will draw it at minimum size
-                {
-                    // Put the right image on the correct position
-                    states.transform.translate(static_cast<float>(m_TextureNormal_L.getSize().x), 0);
-
-                    // Draw the right tab image
-                    if (m_SeparateSelectedImage)
-                    {
-                        if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
-                        else
-                            target.draw(m_TextureNormal_R, states);
-                    }
-                    else // There is no separate selected image
-                    {
-                        target.draw(m_TextureNormal_R, states);
-
-                        if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
-                    }
-
-                    // Undo the translation
-                    states.transform.translate(-static_cast<float>(m_TextureNormal_L.getSize().x), 0);
-                }
-
-                // Undo the scaling of the split images
-                states.transform.scale(1.f/scalingY, 1.f/scalingY);
             }
             else // The image isn't split
             {
@@ -908,16 +876,16 @@ namespace tgui
                 if (m_SeparateSelectedImage)
                 {
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_M, states);
+                        drawCounted(target, m_TextureSelected_M, states);
                     else
-                        target.draw(m_TextureNormal_M, states);
+                        drawCounted(target, m_TextureNormal_M, states);
                 }
                 else // There is no separate selected image
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    drawCounted(target, m_TextureNormal_M, states);
 
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_M, states);
+                        drawCounted(target, m_TextureSelected_M, states);
                 }
 
                 // Undo the scaling
@@ -928,7 +896,7 @@ namespace tgui
             {
                 // Get the current size of the text, so that we can recalculate the position
                 tempText.setString(m_TabNames[i]);
-                realRect = tempText.getLocalBounds();
+                realRect = TGUI_TextMeasurementCache.getLocalBounds(tempText);
 
                 // Calculate the new position for the text
                 if ((m_SplitImage) && (tabWidth == (m_TextureNormal_L.getSize().x + m_TextureNormal_R.getSize().x) * scalingY))
@@ -960,11 +928,11 @@ namespace tgui
                         scissorTop = scissorBottom;
 
                     // Set the clipping area
-                    glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                    setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
                 }
 
                 // Draw the text
-                target.draw(tempText, states);
+                drawCounted(target, tempText, states);
 
                 // Undo the translation of the text
                 states.transform.translate(-std::floor(realRect.left + 0.5f), -std::floor(realRect.top + 0.5f));
@@ -973,7 +941,7 @@ namespace tgui
                 if (clippingRequired)
                 {
                     clippingRequired = false;
-                    glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                    setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
                 }
             }
 
@@ -28,6 +28,8 @@
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/TextBox.hpp>
+#include <TGUI/RenderStats.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -57,7 +59,6 @@ namespace tgui
     m_PossibleDoubleClick     (false)
     {
         m_Callback.widgetType = Type_TextBox;
-        m_AnimatedWidget = true;
         m_DraggableWidget = true;
 
         changeColors();
@@ -177,6 +178,10 @@ namespace tgui
 
     bool TextBox::load(const std::string& configFileFilename)
     {
+        TGUI_PROFILE_ZONE("TextBox::load");
+
+        markDirty();
+
         m_LoadedConfigFile = configFileFilename;
 
         // If there already was a scrollbar then delete it now
@@ -292,6 +297,8 @@ namespace tgui
 
     void TextBox::setSize(float width, float height)
     {
+        markDirty();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -366,6 +373,8 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        markDirty();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -381,6 +390,8 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
+        markDirty();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -403,6 +414,8 @@ namespace tgui
 
     void TextBox::setTextFont(const sf::Font& font)
     {
+        markDirty();
+
         m_TextBeforeSelection.setFont(font);
         m_TextSelection1.setFont(font);
         m_TextSelection2.setFont(font);
@@ -421,6 +434,8 @@ namespace tgui
 
     void TextBox::setTextSize(unsigned int size)
     {
+        markDirty();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -471,6 +486,8 @@ namespace tgui
 
     void TextBox::setMaximumCharacters(unsigned int maxChars)
     {
+        markDirty();
+
         // Set the new character limit ( 0 to disable the limit )
         m_MaxChars = maxChars;
 
@@ -496,6 +513,8 @@ namespace tgui
 
     void TextBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        markDirty();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -552,6 +571,8 @@ namespace tgui
                                const sf::Color& borderColor,
                                const sf::Color& selectionPointColor)
     {
+        markDirty();
+
         m_TextBeforeSelection.setColor(color);
         m_TextSelection1.setColor(selectedColor);
         m_TextSelection2.setColor(selectedColor);
@@ -568,6 +589,8 @@ namespace tgui
 
     void TextBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
+        markDirty();
+
         m_BackgroundColor = backgroundColor;
     }
 
@@ -575,6 +598,8 @@ namespace tgui
 
     void TextBox::setTextColor(const sf::Color& textColor)
     {
+        markDirty();
+
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection1.setColor(textColor);
         m_TextAfterSelection2.setColor(textColor);
@@ -584,6 +609,8 @@ namespace tgui
 
     void TextBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
+        markDirty();
+
         m_TextSelection1.setColor(selectedTextColor);
         m_TextSelection2.setColor(selectedTextColor);
     }
@@ -592,6 +619,8 @@ namespace tgui
 
     void TextBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
+        markDirty();
+
         m_SelectedTextBgrColor = selectedTextBackgroundColor;
     }
 
@@ -599,6 +628,8 @@ namespace tgui
 
     void TextBox::setBorderColor(const sf::Color& borderColor)
     {
+        markDirty();
+
         m_BorderColor = borderColor;
     }
 
@@ -606,6 +637,8 @@ namespace tgui
 
     void TextBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
+        markDirty();
+
         m_SelectionPointColor = selectionPointColor;
     }
 
@@ -655,6 +688,8 @@ namespace tgui
 
     void TextBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        markDirty();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -740,6 +775,8 @@ namespace tgui
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
 
+        markDirty();
+
         // If the scrollbar was already created then delete it first
         if (m_Scroll != nullptr)
             delete m_Scroll;
@@ -770,6 +807,8 @@ namespace tgui
 
     void TextBox::removeScrollbar()
     {
+        markDirty();
+
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
@@ -781,6 +820,8 @@ namespace tgui
 
     void TextBox::setSelectionPointWidth(unsigned int width)
     {
+        markDirty();
+
         m_SelectionPointWidth = width;
     }
 
@@ -795,6 +836,8 @@ namespace tgui
 
     void TextBox::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         Widget::setTransparency(transparency);
 
         m_SelectionPointColor.a = m_Opacity;
@@ -857,6 +900,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Set the mouse down flag to true
         m_MouseDown = true;
 
@@ -978,7 +1023,7 @@ namespace tgui
 
             // The selection point should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
     }
 
@@ -990,6 +1035,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // If there is a scrollbar then pass it the event
         if (m_Scroll != nullptr)
         {
@@ -1064,15 +1111,16 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            // The text box only has to be drawn again when the scrollbar changes (or when text is being selected)
+            const unsigned int oldValue = m_Scroll->getValue();
+            const bool oldMouseHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + m_Size.x - m_RightBorder - m_Scroll->getSize().x, getPosition().y + m_TopBorder);
 
             // Check if you are dragging the thumb of the scrollbar
             if ((m_Scroll->m_MouseDown) && (m_Scroll->m_MouseDownOnThumb))
             {
-                // Remember the old scrollbar value
-                unsigned int oldValue = m_Scroll->getValue();
-
                 // Pass the event, even when the mouse is not on top of the scrollbar
                 m_Scroll->mouseMoved(x, y);
 
@@ -1093,6 +1141,9 @@ namespace tgui
 
             // Reset the position
             m_Scroll->setPosition(0, 0);
+
+            if ((oldValue != m_Scroll->getValue()) || (oldMouseHover != m_Scroll->m_MouseHover))
+                markDirty();
         }
         else // There is no scrollbar
         {
@@ -1133,6 +1184,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // Check if one of the correct keys was pressed
         if (key == sf::Keyboard::Left)
         {
@@ -1157,7 +1210,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::Right)
         {
@@ -1182,7 +1235,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::Up)
         {
@@ -1233,7 +1286,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
             // Don't do anything when the selection point is on the first line
             if (character > 0)
@@ -1338,7 +1391,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
             // Don't do anything when the selection point is on the last line
             if (character < m_Text.getSize())
@@ -1383,7 +1436,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::End)
         {
@@ -1392,7 +1445,7 @@ namespace tgui
 
             // Our selection point has moved, it should be visible
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
         }
         else if (key == sf::Keyboard::Return)
         {
@@ -1433,7 +1486,7 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
             // Add the callback (if the user requested it)
             if (m_CallbackFunctions[TextChanged].empty() == false)
@@ -1477,7 +1530,7 @@ namespace tgui
 
             // The selection point should be visible again
             m_SelectionPointVisible = true;
-            m_AnimationTimeElapsed = sf::Time();
+            scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
             // Add the callback (if the user requested it)
             if (m_CallbackFunctions[TextChanged].empty() == false)
@@ -1497,6 +1550,8 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
+        markDirty();
+
         // If there were selected characters then delete them first
         deleteSelectedCharacters();
 
@@ -1572,7 +1627,7 @@ namespace tgui
 
         // The selection point should be visible again
         m_SelectionPointVisible = true;
-        m_AnimationTimeElapsed = sf::Time();
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
 
         // Add the callback (if the user requested it)
         if (m_CallbackFunctions[TextChanged].empty() == false)
@@ -1592,6 +1647,8 @@ namespace tgui
         {
             if (m_Scroll->getLowValue() < m_Scroll->getMaximum())
             {
+                markDirty();
+
                 // Check if you are scrolling down
                 if (delta < 0)
                 {
@@ -1614,8 +1671,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::widgetFocused()
+    {
+        markDirty();
+
+        // Start blinking the selection point
+        m_SelectionPointVisible = true;
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
+
+        Widget::widgetFocused();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::widgetUnfocused()
     {
+        markDirty();
+
         // If there is a selection then undo it now
         if (m_SelChars)
             setSelectionPointPosition(m_SelEnd);
@@ -1906,6 +1978,8 @@ namespace tgui
 
     void TextBox::selectText(float posX, float posY)
     {
+        markDirty();
+
         // Don't continue when line height is 0
         if (m_LineHeight == 0)
             return;
@@ -1992,6 +2066,8 @@ namespace tgui
 
     void TextBox::updateDisplayedText()
     {
+        TGUI_PROFILE_ZONE("TextBox::updateDisplayedText");
+
         // Don't continue when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -2100,6 +2176,7 @@ namespace tgui
 
         // Fill the temporary text widget with the whole text
         tempText.setString(m_DisplayedText);
+        TGUI_FontManager.trackText(tempText);
 
         // Set the position of the selection point
         m_SelectionPointPosition = sf::Vector2u(tempText.findCharacterPos(m_SelEnd + newlinesAddedBeforeSelection));
@@ -2286,28 +2363,33 @@ namespace tgui
 
     void TextBox::update()
     {
-        // Only show/hide the selection point every half second
-        if (m_AnimationTimeElapsed < sf::milliseconds(500))
-            return;
-
         // Reset the elapsed time
         m_AnimationTimeElapsed = sf::Time();
 
-        // Only update when the editbox is visible
-        if (m_Visible == false)
+        // Too slow for double clicking
+        m_PossibleDoubleClick = false;
+
+        // The selection point only blinks while the text box is focused
+        if (m_Focused == false)
             return;
 
         // Switch the value of the visible flag
-        m_SelectionPointVisible = !m_SelectionPointVisible;
+        if (m_Visible)
+        {
+            m_SelectionPointVisible = !m_SelectionPointVisible;
+            markDirty();
+        }
 
-        // Too slow for double clicking
-        m_PossibleDoubleClick = false;
+        // Show/hide the selection point again after half a second
+        scheduleUpdate(sf::milliseconds(SelectionPointBlinkInterval));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        TGUI_PROFILE_ZONE("TextBox::draw");
+
         // Don't draw anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -2331,21 +2413,21 @@ namespace tgui
             // Draw left border
             sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y)));
             border.setFillColor(m_BorderColor);
-            target.draw(border, states);
+            drawCounted(target, border, states);
 
             // Draw top border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_TopBorder)));
-            target.draw(border, states);
+            drawCounted(target, border, states);
 
             // Draw right border
             border.setPosition(static_cast<float>(m_Size.x - m_RightBorder), 0);
             border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y)));
-            target.draw(border, states);
+            drawCounted(target, border, states);
 
             // Draw bottom border
             border.setPosition(0, static_cast<float>(m_Size.y - m_BottomBorder));
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_BottomBorder)));
-            target.draw(border, states);
+            drawCounted(target, border, states);
         }
 
         // Don't draw on top of the borders
@@ -2354,7 +2436,7 @@ namespace tgui
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x - m_LeftBorder - m_RightBorder), static_cast<float>(m_Size.y - m_TopBorder - m_BottomBorder)));
         front.setFillColor(m_BackgroundColor);
-        target.draw(front, states);
+        drawCounted(target, front, states);
 
         // Set the text on the correct position
         if (m_Scroll != nullptr)
@@ -2382,10 +2464,10 @@ namespace tgui
             scissorTop = scissorBottom;
 
         // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        setScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
 
         // Draw the text
-        target.draw(m_TextBeforeSelection, states);
+        drawCounted(target, m_TextBeforeSelection, states);
 
         // Check if there is a selection
         if (m_SelChars > 0)
@@ -2407,10 +2489,10 @@ namespace tgui
             selectionBackground1.setFillColor(m_SelectedTextBgrColor);
 
             // Draw the selection background
-            target.draw(selectionBackground1, states);
+            drawCounted(target, selectionBackground1, states);
 
             // Draw the first part of the selected text
-            target.draw(m_TextSelection1, states);
+            drawCounted(target, m_TextSelection1, states);
 
             // Check if there is a second part in the selection
             if (m_TextSelection2.getString().getSize() > 0)
@@ -2430,12 +2512,12 @@ namespace tgui
                 for (unsigned int i=0; i<m_MultilineSelectionRectWidth.size(); ++i)
                 {
                     selectionBackground2.setSize(sf::Vector2f(m_MultilineSelectionRectWidth[i], static_cast<float>(m_LineHeight)));
-                    target.draw(selectionBackground2, states);
+                    drawCounted(target, selectionBackground2, states);
                     selectionBackground2.move(0, static_cast<float>(m_LineHeight));
                 }
 
                 // Draw the second part of the selection
-                target.draw(m_TextSelection2, states);
+                drawCounted(target, m_TextSelection2, states);
 
                 // Translate to the end of the selection
                 states.transform.translate(m_TextSelection2.findCharacterPos(textSelection2Length));
@@ -2455,7 +2537,7 @@ namespace tgui
             }
 
             // Draw the first part of the text behind the selection
-            target.draw(m_TextAfterSelection1, states);
+            drawCounted(target, m_TextAfterSelection1, states);
 
             // Check if there is a second part in the selection
             if (m_TextAfterSelection2.getString().getSize() > 0)
@@ -2485,7 +2567,7 @@ namespace tgui
                 }
 
                 // Draw the second part of the text after the selection
-                target.draw(m_TextAfterSelection2, states);
+                drawCounted(target, m_TextAfterSelection2, states);
             }
         }
 
@@ -2504,12 +2586,12 @@ namespace tgui
                 selectionPoint.setFillColor(m_SelectionPointColor);
 
                 // Draw the selection point
-                target.draw(selectionPoint, states);
+                drawCounted(target, selectionPoint, states);
             }
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        setScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
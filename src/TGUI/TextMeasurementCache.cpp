@@ -0,0 +1,267 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2013 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <TGUI/Defines.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // FNV-1a hash of the characters in the string
+    sf::Uint32 hashString(const sf::String& string)
+    {
+        sf::Uint32 hash = 2166136261u;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            hash ^= string[i];
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextMeasurementCache::Key::operator<(const Key& right) const
+    {
+        if (hash != right.hash)
+            return hash < right.hash;
+        else if (length != right.length)
+            return length < right.length;
+        else if (font != right.font)
+            return font < right.font;
+        else if (characterSize != right.characterSize)
+            return characterSize < right.characterSize;
+        else
+            return style < right.style;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMeasurementCache::TextMeasurementCache() :
+    m_Capacity(1024)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect TextMeasurementCache::getLocalBounds(const sf::Text& text)
+    {
+        return getMeasurement(text).bounds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect TextMeasurementCache::getGlobalBounds(const sf::Text& text)
+    {
+        return text.getTransform().transformRect(getMeasurement(text).bounds);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f TextMeasurementCache::findCharacterPos(const sf::Text& text, std::size_t index)
+    {
+        if (text.getFont() == nullptr)
+            return text.findCharacterPos(index);
+
+        const std::vector<sf::Vector2f>& positions = getCharacterPositions(text);
+        if (index >= positions.size())
+            index = positions.size() - 1;
+
+        return text.getTransform().transformPoint(positions[index]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::Vector2f>& TextMeasurementCache::getCharacterPositions(const sf::Text& text)
+    {
+        // Without a font all characters are placed at the origin, just like sf::Text does
+        if (text.getFont() == nullptr)
+        {
+            m_EmptyPositions.assign(text.getString().getSize() + 1, sf::Vector2f());
+            return m_EmptyPositions;
+        }
+
+        TextMeasurement& measurement = getMeasurement(text);
+        if (measurement.characterPositions.empty())
+            calculateCharacterPositions(measurement);
+
+        return measurement.characterPositions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMeasurementCache::setCapacity(unsigned int capacity)
+    {
+        // The measurement that was made last has to stay in the cache, as a reference to it is returned
+        m_Capacity = std::max(capacity, 1u);
+
+        while (m_Measurements.size() > m_Capacity)
+        {
+            const TextMeasurement& oldest = m_Measurements.back();
+
+            Key key;
+            key.font = oldest.font;
+            key.characterSize = oldest.characterSize;
+            key.style = oldest.style;
+            key.length = oldest.string.getSize();
+            key.hash = hashString(oldest.string);
+            m_Index.erase(key);
+
+            m_Measurements.pop_back();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextMeasurementCache::getCapacity() const
+    {
+        return m_Capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMeasurementCache::clear()
+    {
+        m_Index.clear();
+        m_Measurements.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMeasurementCache::removeFont(const sf::Font* font)
+    {
+        std::map<Key, std::list<TextMeasurement>::iterator>::iterator it = m_Index.begin();
+        while (it != m_Index.end())
+        {
+            if (it->first.font == font)
+            {
+                m_Measurements.erase(it->second);
+                m_Index.erase(it++);
+            }
+            else
+                ++it;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMeasurement& TextMeasurementCache::getMeasurement(const sf::Text& text)
+    {
+        Key key;
+        key.font = text.getFont();
+        key.characterSize = text.getCharacterSize();
+        key.style = text.getStyle();
+        key.length = text.getString().getSize();
+        key.hash = hashString(text.getString());
+
+        std::map<Key, std::list<TextMeasurement>::iterator>::iterator it = m_Index.find(key);
+        if (it != m_Index.end())
+        {
+            // Move the measurement to the front, so that it is removed last
+            m_Measurements.splice(m_Measurements.begin(), m_Measurements, it->second);
+
+            // Two different strings can have the same hash, in which case the old measurement is replaced
+            TextMeasurement& measurement = *it->second;
+            if (measurement.string != text.getString())
+            {
+                measurement.string = text.getString();
+                measurement.bounds = text.getLocalBounds();
+                measurement.characterPositions.clear();
+
+                TGUI_FontManager.trackText(text);
+            }
+
+            return measurement;
+        }
+
+        // The text wasn't measured before
+        m_Measurements.push_front(TextMeasurement());
+        TextMeasurement& measurement = m_Measurements.front();
+        measurement.font = key.font;
+        measurement.characterSize = key.characterSize;
+        measurement.style = key.style;
+        measurement.string = text.getString();
+        measurement.bounds = text.getLocalBounds();
+        m_Index[key] = m_Measurements.begin();
+
+        // The glyphs of a text that is measured for the first time were just rendered
+        TGUI_FontManager.trackText(text);
+
+        // Remove the measurements that weren't used for the longest time when there are too many
+        if (m_Measurements.size() > m_Capacity)
+            setCapacity(m_Capacity);
+
+        return m_Measurements.front();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextMeasurementCache::calculateCharacterPositions(TextMeasurement& measurement)
+    {
+        const sf::Font& font = *measurement.font;
+        const sf::String& string = measurement.string;
+        const bool bold = (measurement.style & sf::Text::Bold) != 0;
+
+        const float hspace = static_cast<float>(font.getGlyph(L' ', measurement.characterSize, bold).advance);
+        const float vspace = static_cast<float>(font.getLineSpacing(measurement.characterSize));
+
+        measurement.characterPositions.resize(string.getSize() + 1);
+
+        sf::Vector2f position;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            measurement.characterPositions[i] = position;
+
+            const sf::Uint32 curChar = string[i];
+            position.x += static_cast<float>(font.getKerning(prevChar, curChar, measurement.characterSize));
+            prevChar = curChar;
+
+            switch (curChar)
+            {
+                case L' ':  position.x += hspace;                     continue;
+                case L'\t': position.x += hspace * 4;                 continue;
+                case L'\n': position.y += vspace; position.x = 0;     continue;
+                case L'\v': position.y += vspace * 4;                 continue;
+            }
+
+            position.x += static_cast<float>(font.getGlyph(curChar, measurement.characterSize, bold).advance);
+        }
+
+        measurement.characterPositions[string.getSize()] = position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,7 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <TGUI/Defines.hpp>
+#include <TGUI/Profiler.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -61,7 +61,11 @@ namespace tgui
 
     bool Texture::isTransparentPixel(unsigned int x, unsigned int y)
     {
-        if (data->image.getPixel(sprite.getTextureRect().left + x, sprite.getTextureRect().top + y).a == 0)
+        x += sprite.getTextureRect().left;
+        y += sprite.getTextureRect().top;
+
+        const sf::Uint32 word = data->alphaMask[y * data->alphaMaskRowWords + x / 32];
+        if ((word & (1u << (x % 32))) == 0)
             return true;
         else
             return false;
@@ -78,6 +82,8 @@ namespace tgui
 
     bool TextureManager::getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect)
     {
+        TGUI_PROFILE_ZONE("TextureManager::getTexture");
+
         // Loop all our textures to check if we already have this one
         for (std::list<TextureData>::iterator it = m_Data.begin(); it != m_Data.end(); ++it)
         {
@@ -106,11 +112,15 @@ namespace tgui
         TextureData& data = m_Data.back();
 
         // load the image
-        if (data.image.loadFromFile(filename))
+        sf::Image image;
+        if (image.loadFromFile(filename))
         {
             // Create a texture from the image
-            if (data.texture.loadFromImage(data.image))
+            if (data.texture.loadFromImage(image))
             {
+                // The image itself is not kept, only which pixels are transparent
+                createAlphaMask(image, data);
+
                 // Set the texture in the sprite
                 texture.sprite.setTexture(data.texture, true);
 
@@ -183,6 +193,51 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::list<TextureData>& TextureManager::getTextureData() const
+    {
+        return m_Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::createAlphaMask(const sf::Image& image, TextureData& data)
+    {
+        const unsigned int width = image.getSize().x;
+        const unsigned int height = image.getSize().y;
+
+        data.alphaMaskRowWords = (width + 31) / 32;
+        data.alphaMask.assign(data.alphaMaskRowWords * height, 0);
+
+        const sf::Uint8* pixels = image.getPixelsPtr();
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            const sf::Uint8* row = pixels + y * width * 4;
+            sf::Uint32* maskRow = &data.alphaMask[y * data.alphaMaskRowWords];
+
+            // Whole words are filled without branches, so that the compiler can vectorize the inner loop
+            const unsigned int fullWords = width / 32;
+            for (unsigned int word = 0; word < fullWords; ++word)
+            {
+                const sf::Uint8* alpha = row + word * 32 * 4 + 3;
+
+                sf::Uint32 bits = 0;
+                for (unsigned int bit = 0; bit < 32; ++bit)
+                    bits |= static_cast<sf::Uint32>(alpha[bit * 4] != 0) << bit;
+
+                maskRow[word] = bits;
+            }
+
+            // The pixels at the end of the row that don't fill a complete word
+            for (unsigned int x = fullWords * 32; x < width; ++x)
+            {
+                if (row[x * 4 + 3] != 0)
+                    maskRow[x / 32] |= 1u << (x % 32);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,7 +46,10 @@ namespace tgui
     m_AllowFocus     (false),
     m_AnimatedWidget (false),
     m_DraggableWidget(false),
-    m_ContainerWidget(false)
+    m_ContainerWidget(false),
+    m_EntryIndex     (0),
+    m_Dirty          (true),
+    m_Changed        (true)
     {
         m_Callback.widget = nullptr;
         m_Callback.widgetType = Type_Unknown;
@@ -71,7 +74,10 @@ namespace tgui
     m_AllowFocus     (copy.m_AllowFocus),
     m_AnimatedWidget (copy.m_AnimatedWidget),
     m_DraggableWidget(copy.m_DraggableWidget),
-    m_ContainerWidget(copy.m_ContainerWidget)
+    m_ContainerWidget(copy.m_ContainerWidget),
+    m_EntryIndex     (0),
+    m_Dirty          (true),
+    m_Changed        (true)
     {
         m_Callback.widget = nullptr;
     }
@@ -110,6 +116,8 @@ namespace tgui
             m_Callback.widget     = nullptr;
             m_Callback.widgetType = right.m_Callback.widgetType;
             m_Callback.id         = right.m_Callback.id;
+
+            markDirty();
         }
 
         return *this;
@@ -119,15 +127,27 @@ namespace tgui
 
     void Widget::show()
     {
+        if (!m_Visible)
+            markDirty();
+
         m_Visible = true;
+
+        if (m_Parent)
+            m_Parent->childStateChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::hide()
     {
+        if (m_Visible)
+            markDirty();
+
         m_Visible = false;
 
+        if (m_Parent)
+            m_Parent->childStateChanged(this);
+
         // If the widget is focused then it must be unfocused
         m_Parent->unfocusWidget(this);
     }
@@ -143,19 +163,31 @@ namespace tgui
 
     void Widget::enable()
     {
+        if (!m_Enabled)
+            markDirty();
+
         m_Enabled = true;
+
+        if (m_Parent)
+            m_Parent->childStateChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::disable()
     {
+        if (m_Enabled)
+            markDirty();
+
         m_Enabled = false;
 
         // Change the mouse button state.
         m_MouseHover = false;
         m_MouseDown = false;
 
+        if (m_Parent)
+            m_Parent->childStateChanged(this);
+
         // If the widget is focused then it must be unfocused
         m_Parent->unfocusWidget(this);
     }
@@ -276,6 +308,8 @@ namespace tgui
 
     void Widget::setTransparency(unsigned char transparency)
     {
+        markDirty();
+
         m_Opacity = transparency;
     }
 
@@ -302,6 +336,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setPosition(float x, float y)
+    {
+        markDirty();
+
+        Transformable::setPosition(x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::markDirty()
+    {
+        m_Changed = true;
+
+        // The position or size may have changed, so the parent has to read them again
+        if (m_Parent)
+            m_Parent->childChanged(this);
+
+        // The parents only have to know that one of their children changed.
+        // When a widget is already dirty then so are its parents.
+        Widget* widget = this;
+        while ((widget != nullptr) && (widget->m_Dirty == false))
+        {
+            widget->m_Dirty = true;
+            widget = widget->m_Parent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::markChanged()
+    {
+        m_Changed = true;
+
+        // The widget itself doesn't have to be redrawn, but the parents have to draw it again
+        Widget* widget = m_Parent;
+        while ((widget != nullptr) && (widget->m_Dirty == false))
+        {
+            widget->m_Dirty = true;
+            widget = widget->m_Parent;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isDirty() const
+    {
+        return m_Dirty;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f Widget::getFullSize() const
+    {
+        return getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect Widget::getOpaqueArea() const
+    {
+        return sf::FloatRect();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setCallbackId(unsigned int callbackId)
     {
         m_Callback.id = callbackId;
@@ -322,6 +421,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::scheduleUpdate(const sf::Time& delay)
+    {
+        if (m_Parent)
+            m_Parent->scheduleChildUpdate(this, delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::cancelScheduledUpdate()
+    {
+        if (m_Parent)
+            m_Parent->cancelChildUpdate(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::addCallback()
     {
         // Loop through all callback functions
@@ -340,6 +455,8 @@ namespace tgui
 
     void Widget::mouseEnteredWidget()
     {
+        markDirty();
+
         if (m_CallbackFunctions[MouseEntered].empty() == false)
         {
             m_Callback.trigger = MouseEntered;
@@ -351,6 +468,8 @@ namespace tgui
 
     void Widget::mouseLeftWidget()
     {
+        markDirty();
+
         if (m_CallbackFunctions[MouseLeft].empty() == false)
         {
             m_Callback.trigger = MouseLeft;
@@ -402,6 +521,8 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
+        markDirty();
+
         if (m_CallbackFunctions[Focused].empty() == false)
         {
             m_Callback.trigger = Focused;
@@ -413,6 +534,8 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
+        markDirty();
+
         if (m_CallbackFunctions[Unfocused].empty() == false)
         {
             m_Callback.trigger = Unfocused;
@@ -465,6 +588,11 @@ namespace tgui
                 m_Visible = false;
             else
                 TGUI_OUTPUT("TGUI error: Failed to parse 'Visible' property.");
+
+            markDirty();
+
+            if (m_Parent)
+                m_Parent->childStateChanged(this);
         }
         else if (property == "Enabled")
         {
@@ -474,6 +602,11 @@ namespace tgui
                 m_Enabled = false;
             else
                 TGUI_OUTPUT("TGUI error: Failed to parse 'Enabled' property.");
+
+            markDirty();
+
+            if (m_Parent)
+                m_Parent->childStateChanged(this);
         }
         else if (property == "Transparency")
         {